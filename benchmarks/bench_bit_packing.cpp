@@ -0,0 +1,118 @@
+#include "bench_helper.hpp"
+#include "ml_dsa/internals/poly/bit_packing.hpp"
+#include <benchmark/benchmark.h>
+
+// Benchmark performance of serializing a degree-255 polynomial, with significant sbw -bits per coefficient, using
+// `encode` routine, which uses SIMD bit packing kernels, when target supports them.
+template<size_t sbw>
+void
+poly_encode(benchmark::State& state)
+{
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly{};
+  std::array<uint8_t, (ml_dsa_ntt::N * sbw) / 8> bytes{};
+
+  ml_dsa_prng::prng_t<128> prng;
+  for (size_t i = 0; i < poly.size(); i++) {
+    poly[i] = ml_dsa_field::zq_t::random(prng);
+  }
+
+  for (auto _ : state) {
+    ml_dsa_bit_packing::encode<sbw>(poly, bytes);
+
+    benchmark::DoNotOptimize(poly);
+    benchmark::DoNotOptimize(bytes);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+// Benchmark performance of serializing a degree-255 polynomial, with significant sbw -bits per coefficient, using
+// scalar `pack` routine.
+template<size_t sbw>
+void
+poly_encode_scalar(benchmark::State& state)
+{
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly{};
+  std::array<uint8_t, (ml_dsa_ntt::N * sbw) / 8> bytes{};
+
+  ml_dsa_prng::prng_t<128> prng;
+  for (size_t i = 0; i < poly.size(); i++) {
+    poly[i] = ml_dsa_field::zq_t::random(prng);
+  }
+
+  for (auto _ : state) {
+    ml_dsa_bit_packing::pack<sbw>([&](const size_t i) -> uint32_t { return poly[i].raw(); }, bytes);
+
+    benchmark::DoNotOptimize(poly);
+    benchmark::DoNotOptimize(bytes);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+// Benchmark performance of deserializing a degree-255 polynomial, with significant sbw -bits per coefficient, using
+// `decode` routine, which uses SIMD bit unpacking kernels, when target supports them.
+template<size_t sbw>
+void
+poly_decode(benchmark::State& state)
+{
+  std::array<uint8_t, (ml_dsa_ntt::N * sbw) / 8> bytes{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly{};
+
+  ml_dsa_prng::prng_t<128> prng;
+  prng.read(bytes);
+
+  for (auto _ : state) {
+    ml_dsa_bit_packing::decode<sbw>(bytes, poly);
+
+    benchmark::DoNotOptimize(bytes);
+    benchmark::DoNotOptimize(poly);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+// Benchmark performance of deserializing a degree-255 polynomial, with significant sbw -bits per coefficient, using
+// scalar `unpack` routine.
+template<size_t sbw>
+void
+poly_decode_scalar(benchmark::State& state)
+{
+  std::array<uint8_t, (ml_dsa_ntt::N * sbw) / 8> bytes{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly{};
+
+  ml_dsa_prng::prng_t<128> prng;
+  prng.read(bytes);
+
+  for (auto _ : state) {
+    ml_dsa_bit_packing::unpack<sbw>(bytes, [&](const size_t i, const uint32_t coeff) { poly[i] = ml_dsa_field::zq_t(coeff); });
+
+    benchmark::DoNotOptimize(bytes);
+    benchmark::DoNotOptimize(poly);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+// Bit widths used by ML-DSA, for packing w1 ( 4, 6 ), s1/ s2 ( 3, 4 ), t1 ( 10 ), t0 ( 13 ) and z ( 18, 20 ).
+#define BENCHMARK_BIT_PACKING(sbw)                                                                                                                             \
+  BENCHMARK(poly_encode<sbw>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);                                                   \
+  BENCHMARK(poly_encode_scalar<sbw>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);                                            \
+  BENCHMARK(poly_decode<sbw>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);                                                   \
+  BENCHMARK(poly_decode_scalar<sbw>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+
+BENCHMARK_BIT_PACKING(3);
+BENCHMARK_BIT_PACKING(4);
+BENCHMARK_BIT_PACKING(6);
+BENCHMARK_BIT_PACKING(10);
+BENCHMARK_BIT_PACKING(13);
+BENCHMARK_BIT_PACKING(18);
+BENCHMARK_BIT_PACKING(20);
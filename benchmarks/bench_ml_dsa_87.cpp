@@ -1,6 +1,7 @@
 #include "bench_helper.hpp"
 #include "ml_dsa/ml_dsa_87.hpp"
 #include <benchmark/benchmark.h>
+#include <memory>
 
 // Benchmark performance of ML-DSA-87 key generation algorithm.
 void
@@ -97,6 +98,178 @@ ml_dsa_87_verify(benchmark::State& state)
   state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark performance of ML-DSA-87 signature verification algorithm, using a public key prepared ahead of time.
+void
+ml_dsa_87_verify_prepared(benchmark::State& state)
+{
+  const size_t mlen = state.range(0);
+
+  std::vector<uint8_t> msg(mlen, 0);
+  auto msg_span = std::span(msg);
+
+  std::array<uint8_t, ml_dsa_87::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_87::PubKeyByteLen> pubkey{};
+  std::array<uint8_t, ml_dsa_87::SecKeyByteLen> seckey{};
+  std::array<uint8_t, ml_dsa_87::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_87::SigByteLen> sig{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg_span);
+
+  ml_dsa_87::keygen(seed, pubkey, seckey);
+  ml_dsa_87::sign(rnd, seckey, msg_span, sig);
+
+  auto prepared = std::make_unique<ml_dsa_87::prepared_pubkey_t>();
+  ml_dsa_87::prepare_pubkey(pubkey, *prepared);
+
+  for (auto _ : state) {
+    bool is_valid = ml_dsa_87::verify(*prepared, msg_span, sig);
+
+    benchmark::DoNotOptimize(is_valid);
+    benchmark::DoNotOptimize(prepared);
+    benchmark::DoNotOptimize(msg_span);
+    benchmark::DoNotOptimize(sig);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark performance of ML-DSA-87 signature verification algorithm, using a packed public key, prepared ahead of
+// time.
+void
+ml_dsa_87_verify_prepared_packed(benchmark::State& state)
+{
+  const size_t mlen = state.range(0);
+
+  std::vector<uint8_t> msg(mlen, 0);
+  auto msg_span = std::span(msg);
+
+  std::array<uint8_t, ml_dsa_87::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_87::PubKeyByteLen> pubkey{};
+  std::array<uint8_t, ml_dsa_87::SecKeyByteLen> seckey{};
+  std::array<uint8_t, ml_dsa_87::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_87::SigByteLen> sig{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg_span);
+
+  ml_dsa_87::keygen(seed, pubkey, seckey);
+  ml_dsa_87::sign(rnd, seckey, msg_span, sig);
+
+  auto prepared = std::make_unique<ml_dsa_87::packed_prepared_pubkey_t>();
+  ml_dsa_87::prepare_pubkey(pubkey, *prepared);
+
+  for (auto _ : state) {
+    bool is_valid = ml_dsa_87::verify(*prepared, msg_span, sig);
+
+    benchmark::DoNotOptimize(is_valid);
+    benchmark::DoNotOptimize(prepared);
+    benchmark::DoNotOptimize(msg_span);
+    benchmark::DoNotOptimize(sig);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark performance of ML-DSA-87 signature verification algorithm, using a public key prepared ahead of time,
+// for a message made of a fixed prefix ( say a protocol header ), absorbed ahead of time, and a variable suffix.
+void
+ml_dsa_87_verify_prepared_prefix(benchmark::State& state)
+{
+  const size_t prefix_len = state.range(0);
+  const size_t suffix_len = state.range(1);
+
+  std::vector<uint8_t> msg(prefix_len + suffix_len, 0);
+  auto msg_span = std::span(msg);
+
+  std::array<uint8_t, ml_dsa_87::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_87::PubKeyByteLen> pubkey{};
+  std::array<uint8_t, ml_dsa_87::SecKeyByteLen> seckey{};
+  std::array<uint8_t, ml_dsa_87::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_87::SigByteLen> sig{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg_span);
+
+  ml_dsa_87::keygen(seed, pubkey, seckey);
+  ml_dsa_87::sign(rnd, seckey, msg_span, sig);
+
+  auto prepared = std::make_unique<ml_dsa_87::prepared_pubkey_t>();
+  ml_dsa_87::prepare_pubkey(pubkey, *prepared);
+
+  auto prefix_state = std::make_unique<ml_dsa::mu_prefix_t>();
+  ml_dsa::absorb_prefix(prepared->tr, msg_span.first(prefix_len), *prefix_state);
+
+  auto suffix = msg_span.subspan(prefix_len);
+
+  for (auto _ : state) {
+    bool is_valid = ml_dsa_87::verify(*prepared, *prefix_state, suffix, sig);
+
+    benchmark::DoNotOptimize(is_valid);
+    benchmark::DoNotOptimize(prepared);
+    benchmark::DoNotOptimize(suffix);
+    benchmark::DoNotOptimize(sig);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark performance of ML-DSA-87 verification of many signatures under the same public key, which is expanded
+// once per call. Items processed are signatures.
+void
+ml_dsa_87_verify_many(benchmark::State& state)
+{
+  const size_t mlen = state.range(0);
+  const size_t sig_cnt = state.range(1);
+
+  std::array<uint8_t, ml_dsa_87::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_87::PubKeyByteLen> pubkey{};
+  std::array<uint8_t, ml_dsa_87::SecKeyByteLen> seckey{};
+
+  std::vector<std::vector<uint8_t>> msgs(sig_cnt, std::vector<uint8_t>(mlen, 0));
+  std::vector<std::array<uint8_t, ml_dsa_87::SigByteLen>> sigs(sig_cnt);
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  ml_dsa_87::keygen(seed, pubkey, seckey);
+
+  for (size_t i = 0; i < sig_cnt; i++) {
+    std::array<uint8_t, ml_dsa_87::SigningSeedByteLen> rnd{};
+    prng.read(rnd);
+    prng.read(msgs[i]);
+
+    ml_dsa_87::sign(rnd, seckey, msgs[i], sigs[i]);
+  }
+
+  std::vector<std::span<const uint8_t>> msg_spans(msgs.begin(), msgs.end());
+  std::vector<std::span<const uint8_t, ml_dsa_87::SigByteLen>> sig_spans(sigs.begin(), sigs.end());
+  auto status = std::make_unique<bool[]>(sig_cnt);
+
+  for (auto _ : state) {
+    bool are_all_valid = ml_dsa_87::verify_many(pubkey, msg_spans, sig_spans, std::span(status.get(), sig_cnt));
+
+    benchmark::DoNotOptimize(are_all_valid);
+    benchmark::DoNotOptimize(msg_spans);
+    benchmark::DoNotOptimize(sig_spans);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * sig_cnt);
+}
+
 BENCHMARK(ml_dsa_87_keygen)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
 BENCHMARK(ml_dsa_87_sign)->Arg(32)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
 BENCHMARK(ml_dsa_87_verify)->Arg(32)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ml_dsa_87_verify_prepared)->Arg(32)->Arg(16416)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ml_dsa_87_verify_prepared_packed)->Arg(32)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ml_dsa_87_verify_prepared_prefix)->Args({ 16384, 32 })->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(ml_dsa_87_verify_many)->Args({ 32, 16 })->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
@@ -0,0 +1,148 @@
+#include "bench_helper.hpp"
+#include "ml_dsa/internals/rng/prng.hpp"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Benchmarks of HashML-DSA
+//
+// Streaming digest of messages of growing length, using each pre-hash function, reporting bytes processed per second,
+// followed by signing and verifying a digest, for each parameter set, which costs the same, no matter how long the
+// digested message was.
+
+// Benchmark performance of computing digest of a message, in chunks of 4 KiB, using given pre-hash function.
+template<ml_dsa_prehash::hash_t hash>
+void
+prehash_digest(benchmark::State& state)
+{
+  constexpr size_t CHUNK_BYTE_LEN = 4096;
+  const size_t mlen = state.range(0);
+
+  std::vector<uint8_t> msg(mlen, 0);
+  std::array<uint8_t, ml_dsa_prehash::DIGEST_BYTE_LEN<hash>> digest{};
+
+  ml_dsa_prng::prng_t<128> prng;
+  prng.read(msg);
+
+  const auto msg_span = std::span<const uint8_t>(msg);
+
+  for (auto _ : state) {
+    ml_dsa_prehash::prehasher_t<hash> prehasher;
+    for (size_t off = 0; off < mlen; off += CHUNK_BYTE_LEN) {
+      prehasher.absorb(msg_span.subspan(off, std::min(CHUNK_BYTE_LEN, mlen - off)));
+    }
+    prehasher.digest(digest);
+
+    benchmark::DoNotOptimize(digest);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(mlen * state.iterations()));
+}
+
+// Key pair, prepared keys and SHAKE256 digest of a random message, along with its HashML-DSA signature.
+template<ml_dsa_runtime::param_set_t param_set>
+struct prehash_fixture_t
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  static constexpr auto HASH = ml_dsa_prehash::hash_t::shake256;
+
+  std::array<uint8_t, ml_dsa_utils::pub_key_len(p::k, p::d)> pubkey{};
+  std::array<uint8_t, ml_dsa_utils::sec_key_len(p::k, p::l, p::η, p::d)> seckey{};
+  std::array<uint8_t, ml_dsa::RND_BYTE_LEN> rnd{};
+  std::array<uint8_t, ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ)> sig{};
+  std::array<uint8_t, ml_dsa_prehash::DIGEST_BYTE_LEN<HASH>> digest{};
+  std::array<uint8_t, 16> ctx{};
+
+  ml_dsa::prepared_seckey_t<p::k, p::l> prepared_seckey{};
+  ml_dsa::prepared_pubkey_t<p::k, p::l> prepared_pubkey{};
+
+  prehash_fixture_t()
+  {
+    std::array<uint8_t, ml_dsa::KEYGEN_SEED_BYTE_LEN> seed{};
+    std::array<uint8_t, 1024> msg{};
+
+    ml_dsa_prng::prng_t<256> prng;
+    prng.read(seed);
+    prng.read(rnd);
+    prng.read(msg);
+    prng.read(ctx);
+
+    ml_dsa::keygen<p::k, p::l, p::d, p::η>(seed, pubkey, seckey);
+    ml_dsa::prepare_seckey<p::k, p::l, p::d, p::η>(seckey, prepared_seckey);
+    ml_dsa::prepare_pubkey<p::k, p::l, p::d>(pubkey, prepared_pubkey);
+
+    ml_dsa_prehash::digest<HASH>(msg, digest);
+    ml_dsa::sign_prehash<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, prepared_seckey, ctx, HASH, digest, sig);
+  }
+};
+
+// Benchmark performance of HashML-DSA signing of a SHAKE256 digest, using a prepared secret key.
+template<ml_dsa_runtime::param_set_t param_set>
+void
+sign_prehash(benchmark::State& state)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  using fixture_t = prehash_fixture_t<param_set>;
+
+  auto fixture = std::make_unique<fixture_t>();
+
+  for (auto _ : state) {
+    const bool is_signed = ml_dsa::sign_prehash<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(
+      fixture->rnd, fixture->prepared_seckey, fixture->ctx, fixture_t::HASH, fixture->digest, fixture->sig);
+
+    benchmark::DoNotOptimize(is_signed);
+    benchmark::DoNotOptimize(fixture->sig);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark performance of HashML-DSA verification of a signature over SHAKE256 digest, using a prepared public key.
+template<ml_dsa_runtime::param_set_t param_set>
+void
+verify_prehash(benchmark::State& state)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  using fixture_t = prehash_fixture_t<param_set>;
+
+  auto fixture = std::make_unique<fixture_t>();
+
+  for (auto _ : state) {
+    const bool is_valid = ml_dsa::verify_prehash<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(
+      fixture->prepared_pubkey, fixture->ctx, fixture_t::HASH, fixture->digest, fixture->sig);
+
+    benchmark::DoNotOptimize(is_valid);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define BENCHMARK_PREHASH_DIGEST(hash)                                                                                                                         \
+  BENCHMARK(prehash_digest<ml_dsa_prehash::hash_t::hash>)                                                                                                      \
+    ->Name("prehash/" #hash)                                                                                                                                   \
+    ->RangeMultiplier(16)                                                                                                                                      \
+    ->Range(1 << 10, 1 << 22)                                                                                                                                  \
+    ->ComputeStatistics("min", compute_min)                                                                                                                    \
+    ->ComputeStatistics("max", compute_max)
+
+BENCHMARK_PREHASH_DIGEST(sha3_256);
+BENCHMARK_PREHASH_DIGEST(sha3_512);
+BENCHMARK_PREHASH_DIGEST(shake128);
+BENCHMARK_PREHASH_DIGEST(shake256);
+
+#define BENCHMARK_PREHASH_SIGN_VERIFY(ps)                                                                                                                      \
+  BENCHMARK(sign_prehash<ml_dsa_runtime::param_set_t::ps>)                                                                                                     \
+    ->Name(#ps "_sign_prehash")                                                                                                                                \
+    ->ComputeStatistics("min", compute_min)                                                                                                                    \
+    ->ComputeStatistics("max", compute_max);                                                                                                                   \
+  BENCHMARK(verify_prehash<ml_dsa_runtime::param_set_t::ps>)                                                                                                   \
+    ->Name(#ps "_verify_prehash")                                                                                                                              \
+    ->ComputeStatistics("min", compute_min)                                                                                                                    \
+    ->ComputeStatistics("max", compute_max)
+
+BENCHMARK_PREHASH_SIGN_VERIFY(ml_dsa_44);
+BENCHMARK_PREHASH_SIGN_VERIFY(ml_dsa_65);
+BENCHMARK_PREHASH_SIGN_VERIFY(ml_dsa_87);
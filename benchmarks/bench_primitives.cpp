@@ -0,0 +1,387 @@
+#include "bench_helper.hpp"
+#include "ml_dsa/ml_dsa_44.hpp"
+#include "ml_dsa/ml_dsa_65.hpp"
+#include "ml_dsa/ml_dsa_87.hpp"
+#include <benchmark/benchmark.h>
+
+// Benchmarks of internal primitives, which ML-DSA keygen, sign and verify are built of, so that a regression of any of
+// top-level routines can be attributed to the primitive(s) it comes from. Each benchmark reports throughput in terms of
+// bytes processed, while `make perf` also reports CPU cycles, using libPFM counters.
+
+using zq_t = ml_dsa_field::zq_t;
+using poly_t = std::span<zq_t, ml_dsa_ntt::N>;
+
+// Fills a vector of n polynomials with random coefficients ∈ [0, Q).
+template<size_t n>
+static std::array<zq_t, n * ml_dsa_ntt::N>
+random_polyvec(ml_dsa_prng::prng_t<256>& prng)
+{
+  std::array<zq_t, n * ml_dsa_ntt::N> vec{};
+  for (auto& coeff : vec) {
+    coeff = zq_t::random(prng);
+  }
+  return vec;
+}
+
+// Fills k bitsets of 256 -bits each, with ω bits set at random positions ( repetitions possible ).
+template<size_t k, size_t ω>
+static std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY>
+random_hint(ml_dsa_prng::prng_t<256>& prng)
+{
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint{};
+  std::array<uint8_t, 2> pos{};
+
+  for (size_t i = 0; i < ω; i++) {
+    prng.read(pos);
+
+    const size_t poly_idx = pos[0] % k;
+    const size_t bit_idx = pos[1];
+    hint[poly_idx * ml_dsa_bit_packing::HINT_WORDS_PER_POLY + bit_idx / 64] |= 1ul << (bit_idx % 64);
+  }
+  return hint;
+}
+
+// Benchmark performance of forward NTT over a degree-255 polynomial.
+void
+poly_ntt(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto poly = random_polyvec<1>(prng);
+
+  for (auto _ : state) {
+    ml_dsa_ntt::ntt(poly);
+
+    benchmark::DoNotOptimize(poly);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(poly));
+}
+
+// Benchmark performance of inverse NTT over a degree-255 polynomial.
+void
+poly_intt(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto poly = random_polyvec<1>(prng);
+
+  for (auto _ : state) {
+    ml_dsa_ntt::intt(poly);
+
+    benchmark::DoNotOptimize(poly);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(poly));
+}
+
+// Benchmark performance of sampling k x l public matrix A, from 32 -bytes seed ρ.
+template<size_t k, size_t l>
+void
+expand_a(benchmark::State& state)
+{
+  std::array<uint8_t, 32> rho{};
+  std::array<zq_t, k * l * ml_dsa_ntt::N> mat{};
+
+  ml_dsa_prng::prng_t<256> prng;
+  prng.read(rho);
+
+  for (auto _ : state) {
+    ml_dsa_sampling::expand_a<k, l>(rho, mat);
+
+    benchmark::DoNotOptimize(rho);
+    benchmark::DoNotOptimize(mat);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(mat));
+}
+
+// Benchmark performance of sampling a vector of k secret polynomials, with coefficients ∈ [-η, η].
+template<uint32_t η, size_t k>
+void
+expand_s(benchmark::State& state)
+{
+  std::array<uint8_t, 64> rho_prime{};
+  std::array<zq_t, k * ml_dsa_ntt::N> vec{};
+
+  ml_dsa_prng::prng_t<256> prng;
+  prng.read(rho_prime);
+
+  for (auto _ : state) {
+    ml_dsa_sampling::expand_s<η, k, 0>(rho_prime, vec);
+
+    benchmark::DoNotOptimize(rho_prime);
+    benchmark::DoNotOptimize(vec);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(vec));
+}
+
+// Benchmark performance of sampling masking vector y, of l polynomials, with coefficients ∈ [-(γ1-1), γ1].
+template<uint32_t γ1, size_t l>
+void
+expand_mask(benchmark::State& state)
+{
+  std::array<uint8_t, 64> seed{};
+  std::array<zq_t, l * ml_dsa_ntt::N> vec{};
+
+  ml_dsa_prng::prng_t<256> prng;
+  prng.read(seed);
+
+  for (auto _ : state) {
+    ml_dsa_sampling::expand_mask<γ1, l>(seed, 0, vec);
+
+    benchmark::DoNotOptimize(seed);
+    benchmark::DoNotOptimize(vec);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(vec));
+}
+
+// Benchmark performance of sampling challenge polynomial c, with τ coefficients set to ±1.
+template<uint32_t τ>
+void
+sample_in_ball(benchmark::State& state)
+{
+  std::array<uint8_t, 32> seed{};
+  std::array<zq_t, ml_dsa_ntt::N> poly{};
+
+  ml_dsa_prng::prng_t<256> prng;
+  prng.read(seed);
+
+  for (auto _ : state) {
+    ml_dsa_sampling::sample_in_ball<τ>(seed, poly);
+
+    benchmark::DoNotOptimize(seed);
+    benchmark::DoNotOptimize(poly);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(poly));
+}
+
+// Benchmark performance of multiplying k x l matrix A with l x 1 vector, both in NTT domain.
+template<size_t k, size_t l>
+void
+matrix_multiply(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto mat = random_polyvec<k * l>(prng);
+  auto vec = random_polyvec<l>(prng);
+  std::array<zq_t, k * ml_dsa_ntt::N> res{};
+
+  for (auto _ : state) {
+    std::fill(res.begin(), res.end(), zq_t::zero());
+    ml_dsa_polyvec::matrix_multiply<k, l, l, 1>(mat, vec, res);
+
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(vec);
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * (sizeof(mat) + sizeof(vec)));
+}
+
+// Benchmark performance of extracting high order bits of a vector of k polynomials.
+template<size_t k, uint32_t γ2>
+void
+highbits(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto src = random_polyvec<k>(prng);
+  std::array<zq_t, k * ml_dsa_ntt::N> dst{};
+
+  for (auto _ : state) {
+    ml_dsa_polyvec::highbits<k, 2 * γ2>(src, dst);
+
+    benchmark::DoNotOptimize(src);
+    benchmark::DoNotOptimize(dst);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(src));
+}
+
+// Benchmark performance of extracting low order bits of a vector of k polynomials.
+template<size_t k, uint32_t γ2>
+void
+lowbits(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto src = random_polyvec<k>(prng);
+  std::array<zq_t, k * ml_dsa_ntt::N> dst{};
+
+  for (auto _ : state) {
+    ml_dsa_polyvec::lowbits<k, 2 * γ2>(src, dst);
+
+    benchmark::DoNotOptimize(src);
+    benchmark::DoNotOptimize(dst);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(src));
+}
+
+// Benchmark performance of extracting both high and low order bits of a vector of k polynomials, in a single pass.
+template<size_t k, uint32_t γ2>
+void
+decompose(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto src = random_polyvec<k>(prng);
+  std::array<zq_t, k * ml_dsa_ntt::N> hi{};
+  std::array<zq_t, k * ml_dsa_ntt::N> lo{};
+
+  for (auto _ : state) {
+    ml_dsa_polyvec::decompose<k, 2 * γ2>(src, hi, lo);
+
+    benchmark::DoNotOptimize(src);
+    benchmark::DoNotOptimize(hi);
+    benchmark::DoNotOptimize(lo);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(src));
+}
+
+// Benchmark performance of computing hint bits of a vector of k polynomials, from `-ct0` and `w - cs2 + ct0`.
+template<size_t k, uint32_t γ2>
+void
+make_hint(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto polya = random_polyvec<k>(prng);
+  auto polyb = random_polyvec<k>(prng);
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint{};
+
+  for (auto _ : state) {
+    ml_dsa_polyvec::make_hint<k, 2 * γ2>(polya, polyb, hint);
+
+    benchmark::DoNotOptimize(polya);
+    benchmark::DoNotOptimize(polyb);
+    benchmark::DoNotOptimize(hint);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * (sizeof(polya) + sizeof(polyb)));
+}
+
+// Benchmark performance of computing hint bits of a vector of k polynomials, from already decomposed `w - cs2 + ct0`.
+template<size_t k, uint32_t γ2>
+void
+make_hint_decomposed(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto src = random_polyvec<k>(prng);
+  std::array<zq_t, k * ml_dsa_ntt::N> r1{};
+  std::array<zq_t, k * ml_dsa_ntt::N> r0{};
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint{};
+
+  ml_dsa_polyvec::decompose<k, 2 * γ2>(src, r1, r0);
+
+  for (auto _ : state) {
+    ml_dsa_polyvec::make_hint_decomposed<k, 2 * γ2>(r0, r1, hint);
+
+    benchmark::DoNotOptimize(r0);
+    benchmark::DoNotOptimize(r1);
+    benchmark::DoNotOptimize(hint);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * (sizeof(r0) + sizeof(r1)));
+}
+
+// Benchmark performance of recovering high order bits of a vector of k polynomials, using hint bits.
+template<size_t k, uint32_t γ2, size_t ω>
+void
+use_hint(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto hint = random_hint<k, ω>(prng);
+  auto polyr = random_polyvec<k>(prng);
+  std::array<zq_t, k * ml_dsa_ntt::N> polyrz{};
+
+  for (auto _ : state) {
+    ml_dsa_polyvec::use_hint<k, 2 * γ2>(hint, polyr, polyrz);
+
+    benchmark::DoNotOptimize(hint);
+    benchmark::DoNotOptimize(polyr);
+    benchmark::DoNotOptimize(polyrz);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(polyr));
+}
+
+// Benchmark performance of serializing hint bits, of a vector of k polynomials, into (ω + k) -bytes.
+template<size_t k, size_t ω>
+void
+encode_hint_bits(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto hint = random_hint<k, ω>(prng);
+  std::array<uint8_t, ω + k> bytes{};
+
+  for (auto _ : state) {
+    ml_dsa_bit_packing::encode_hint_bits<k, ω>(hint, bytes);
+
+    benchmark::DoNotOptimize(hint);
+    benchmark::DoNotOptimize(bytes);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(bytes));
+}
+
+// Benchmark performance of deserializing (ω + k) -bytes into hint bits, of a vector of k polynomials.
+template<size_t k, size_t ω>
+void
+decode_hint_bits(benchmark::State& state)
+{
+  ml_dsa_prng::prng_t<256> prng;
+  auto hint = random_hint<k, ω>(prng);
+  std::array<uint8_t, ω + k> bytes{};
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> decoded{};
+
+  ml_dsa_bit_packing::encode_hint_bits<k, ω>(hint, bytes);
+
+  for (auto _ : state) {
+    const bool failed = ml_dsa_bit_packing::decode_hint_bits<k, ω>(bytes, decoded);
+
+    benchmark::DoNotOptimize(bytes);
+    benchmark::DoNotOptimize(failed);
+    benchmark::DoNotOptimize(decoded);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(bytes));
+}
+
+#define BENCHMARK_PRIMITIVE(fn, name) BENCHMARK(fn)->Name(name)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)
+
+BENCHMARK_PRIMITIVE(poly_ntt, "ntt");
+BENCHMARK_PRIMITIVE(poly_intt, "intt");
+
+// Registers benchmarks of all parameter set dependent primitives, for given ML-DSA parameter set ( i.e. namespace ).
+#define BENCHMARK_PRIMITIVES(ps)                                                                                                                               \
+  BENCHMARK_PRIMITIVE((expand_a<ps::k, ps::l>), #ps "/expand_a");                                                                                              \
+  BENCHMARK_PRIMITIVE((expand_s<ps::η, ps::l>), #ps "/expand_s");                                                                                              \
+  BENCHMARK_PRIMITIVE((expand_mask<ps::γ1, ps::l>), #ps "/expand_mask");                                                                                       \
+  BENCHMARK_PRIMITIVE(sample_in_ball<ps::τ>, #ps "/sample_in_ball");                                                                                           \
+  BENCHMARK_PRIMITIVE((matrix_multiply<ps::k, ps::l>), #ps "/matrix_multiply");                                                                                \
+  BENCHMARK_PRIMITIVE((highbits<ps::k, ps::γ2>), #ps "/highbits");                                                                                             \
+  BENCHMARK_PRIMITIVE((lowbits<ps::k, ps::γ2>), #ps "/lowbits");                                                                                               \
+  BENCHMARK_PRIMITIVE((decompose<ps::k, ps::γ2>), #ps "/decompose");                                                                                           \
+  BENCHMARK_PRIMITIVE((make_hint<ps::k, ps::γ2>), #ps "/make_hint");                                                                                           \
+  BENCHMARK_PRIMITIVE((make_hint_decomposed<ps::k, ps::γ2>), #ps "/make_hint_decomposed");                                                                     \
+  BENCHMARK_PRIMITIVE((use_hint<ps::k, ps::γ2, ps::ω>), #ps "/use_hint");                                                                                      \
+  BENCHMARK_PRIMITIVE((encode_hint_bits<ps::k, ps::ω>), #ps "/encode_hint_bits");                                                                              \
+  BENCHMARK_PRIMITIVE((decode_hint_bits<ps::k, ps::ω>), #ps "/decode_hint_bits");
+
+BENCHMARK_PRIMITIVES(ml_dsa_44);
+BENCHMARK_PRIMITIVES(ml_dsa_65);
+BENCHMARK_PRIMITIVES(ml_dsa_87);
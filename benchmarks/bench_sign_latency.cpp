@@ -0,0 +1,169 @@
+#include "bench_helper.hpp"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Signing latency distribution benchmark
+//
+// Number of iterations of the rejection sampling loop of ML-DSA signing ( say κ ) depends on secret key, message and
+// signing seed, so timing signing of a single fixed input hides the latency distribution. Following benchmarks sign
+// a corpus of random keys, with a fresh random message and signing seed, for each call, timing each call on its own.
+// They report
+//
+// - p50, p90, p99 and p99.9 latency, in microseconds.
+// - Histogram of κ, as fraction of calls, which took κ = 1, 2, ..., 8 or more iterations.
+// - Least squares fit of latency = fixed + κ x per_iteration, separating per-call overhead ( hashing message, expanding
+//   secret key etc. ) from cost of each iteration of the rejection sampling loop.
+
+// Number of distinct keypairs, signing calls are spread over.
+static constexpr size_t KEY_CORPUS_SIZE = 32;
+
+// κ >= this value goes into the last bucket of the histogram.
+static constexpr size_t KAPPA_HISTOGRAM_BUCKETS = 8;
+
+// Returns p-th ( ∈ [0, 1] ) percentile of sorted samples, using nearest-rank method.
+static double
+percentile(const std::vector<double>& sorted, const double p)
+{
+  const size_t rank = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+  return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+// Given per-call latencies and κ values, this routine reports latency percentiles, κ histogram and least squares fit
+// of latency against κ, as benchmark counters.
+static void
+report_latency_distribution(benchmark::State& state, std::vector<double> latencies, const std::vector<size_t>& kappas)
+{
+  if (latencies.empty()) {
+    return;
+  }
+
+  const double n = static_cast<double>(latencies.size());
+
+  // Least squares fit of latency = fixed + per_iteration * κ
+  double sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+  for (size_t i = 0; i < latencies.size(); i++) {
+    const double x = static_cast<double>(kappas[i]);
+    const double y = latencies[i];
+
+    sum_x += x;
+    sum_y += y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+  }
+
+  const double denom = n * sum_xx - sum_x * sum_x;
+  const double per_iteration = (denom != 0) ? (n * sum_xy - sum_x * sum_y) / denom : 0;
+  const double fixed = (sum_y - per_iteration * sum_x) / n;
+
+  std::sort(latencies.begin(), latencies.end());
+
+  state.counters["p50_us"] = percentile(latencies, 0.50);
+  state.counters["p90_us"] = percentile(latencies, 0.90);
+  state.counters["p99_us"] = percentile(latencies, 0.99);
+  state.counters["p99.9_us"] = percentile(latencies, 0.999);
+  state.counters["fixed_us"] = fixed;
+  state.counters["per_iter_us"] = per_iteration;
+  state.counters["kappa_mean"] = sum_x / n;
+
+  std::array<size_t, KAPPA_HISTOGRAM_BUCKETS> histogram{};
+  for (const size_t kappa : kappas) {
+    histogram[std::min(kappa, KAPPA_HISTOGRAM_BUCKETS) - 1]++;
+  }
+
+  for (size_t i = 0; i < histogram.size(); i++) {
+    const std::string name = "kappa=" + std::to_string(i + 1) + ((i + 1 == KAPPA_HISTOGRAM_BUCKETS) ? "+" : "");
+    state.counters[name] = static_cast<double>(histogram[i]) / n;
+  }
+}
+
+// Benchmark latency distribution of ML-DSA signing, over a corpus of random keys and messages. When `prepared` is
+// true, secret keys are expanded before timing starts, so that fixed per-call cost excludes secret key expansion.
+template<ml_dsa_runtime::param_set_t param_set, bool prepared>
+void
+sign_latency(benchmark::State& state)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  using prepared_seckey_t = ml_dsa::prepared_seckey_t<p::k, p::l>;
+
+  constexpr size_t seckey_len = ml_dsa_utils::sec_key_len(p::k, p::l, p::η, p::d);
+  constexpr size_t pubkey_len = ml_dsa_utils::pub_key_len(p::k, p::d);
+  constexpr size_t sig_len = ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ);
+
+  const size_t mlen = state.range(0);
+
+  ml_dsa_prng::prng_t<256> prng;
+
+  std::vector<std::array<uint8_t, seckey_len>> seckeys(KEY_CORPUS_SIZE);
+  auto prepared_seckeys = std::make_unique<prepared_seckey_t[]>(prepared ? KEY_CORPUS_SIZE : 0);
+
+  for (size_t i = 0; i < KEY_CORPUS_SIZE; i++) {
+    std::array<uint8_t, ml_dsa::KEYGEN_SEED_BYTE_LEN> seed{};
+    std::array<uint8_t, pubkey_len> pubkey{};
+
+    prng.read(seed);
+    ml_dsa::keygen<p::k, p::l, p::d, p::η>(seed, pubkey, seckeys[i]);
+
+    if constexpr (prepared) {
+      ml_dsa::prepare_seckey<p::k, p::l, p::d, p::η>(seckeys[i], prepared_seckeys[i]);
+    }
+  }
+
+  std::vector<uint8_t> msg(mlen, 0);
+  std::array<uint8_t, ml_dsa::RND_BYTE_LEN> rnd{};
+  std::array<uint8_t, sig_len> sig{};
+
+  std::vector<double> latencies;
+  std::vector<size_t> kappas;
+
+  size_t key_idx = 0;
+  for (auto _ : state) {
+    prng.read(msg);
+    prng.read(rnd);
+
+    size_t kappa = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+
+    if constexpr (prepared) {
+      kappa = ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, prepared_seckeys[key_idx], msg, sig);
+    } else {
+      prepared_seckey_t expanded{};
+
+      ml_dsa::prepare_seckey<p::k, p::l, p::d, p::η>(seckeys[key_idx], expanded);
+      kappa = ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, expanded, msg, sig);
+    }
+
+    benchmark::DoNotOptimize(sig);
+    benchmark::ClobberMemory();
+
+    const auto t1 = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration<double>(t1 - t0);
+
+    state.SetIterationTime(elapsed.count());
+    latencies.push_back(elapsed.count() * 1e6);
+    kappas.push_back(kappa);
+
+    key_idx = (key_idx + 1) % KEY_CORPUS_SIZE;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  report_latency_distribution(state, std::move(latencies), kappas);
+}
+
+#define BENCHMARK_SIGN_LATENCY(ps, prepared, name)                                                                                                             \
+  BENCHMARK(sign_latency<ml_dsa_runtime::param_set_t::ps, prepared>)                                                                                           \
+    ->Name(name)                                                                                                                                               \
+    ->Arg(32)                                                                                                                                                  \
+    ->UseManualTime()                                                                                                                                          \
+    ->ComputeStatistics("min", compute_min)                                                                                                                    \
+    ->ComputeStatistics("max", compute_max)
+
+BENCHMARK_SIGN_LATENCY(ml_dsa_44, false, "ml_dsa_44/sign_latency");
+BENCHMARK_SIGN_LATENCY(ml_dsa_44, true, "ml_dsa_44/sign_latency_prepared");
+BENCHMARK_SIGN_LATENCY(ml_dsa_65, false, "ml_dsa_65/sign_latency");
+BENCHMARK_SIGN_LATENCY(ml_dsa_65, true, "ml_dsa_65/sign_latency_prepared");
+BENCHMARK_SIGN_LATENCY(ml_dsa_87, false, "ml_dsa_87/sign_latency");
+BENCHMARK_SIGN_LATENCY(ml_dsa_87, true, "ml_dsa_87/sign_latency_prepared");
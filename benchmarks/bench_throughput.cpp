@@ -0,0 +1,163 @@
+#include "bench_helper.hpp"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+// Multi-threaded throughput scaling benchmark
+//
+// Runs ML-DSA keygen, sign and verify on 1..N threads ( N = number of hardware threads ), where all threads either
+// share one keypair or each thread works with its own keypair. Reports aggregate operations per second, as
+// `items_per_second`, and `efficiency`, which is aggregate throughput relative to linear scaling of single-threaded
+// throughput, so that effects of shared caches and memory bandwidth, on the large matrices and vectors ML-DSA keeps on
+// stack, show up.
+
+enum class op_t : uint8_t
+{
+  keygen,
+  sign,
+  verify,
+};
+
+// Whether all threads use the same keypair or each thread uses its own.
+enum class keys_t : uint8_t
+{
+  shared,
+  independent,
+};
+
+// Duration of single-threaded calibration run, which measures baseline throughput, for computing efficiency.
+static constexpr auto CALIBRATION_TIME = std::chrono::milliseconds(250);
+
+template<ml_dsa_runtime::param_set_t param_set>
+struct keypair_t
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+
+  std::array<uint8_t, ml_dsa_utils::pub_key_len(p::k, p::d)> pubkey{};
+  std::array<uint8_t, ml_dsa_utils::sec_key_len(p::k, p::l, p::η, p::d)> seckey{};
+  std::array<uint8_t, ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ)> sig{};
+  std::array<uint8_t, 32> msg{};
+
+  // Generates a fresh keypair, using seed read from `prng`, and signs a random message, so that the signature can be verified.
+  explicit keypair_t(ml_dsa_prng::prng_t<256>& prng)
+  {
+    std::array<uint8_t, ml_dsa::KEYGEN_SEED_BYTE_LEN> seed{};
+    std::array<uint8_t, ml_dsa::RND_BYTE_LEN> rnd{};
+
+    prng.read(seed);
+    prng.read(rnd);
+    prng.read(msg);
+
+    ml_dsa::keygen<p::k, p::l, p::d, p::η>(seed, pubkey, seckey);
+    ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, seckey, msg, sig);
+  }
+};
+
+// Executes given operation once, on given keypair, writing generated keys or signature to `out`.
+template<ml_dsa_runtime::param_set_t param_set, op_t op>
+static inline void
+run_op(const keypair_t<param_set>& keypair, keypair_t<param_set>& out, std::span<const uint8_t, 32> seed)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+
+  if constexpr (op == op_t::keygen) {
+    ml_dsa::keygen<p::k, p::l, p::d, p::η>(seed, out.pubkey, out.seckey);
+  } else if constexpr (op == op_t::sign) {
+    ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(seed, keypair.seckey, keypair.msg, out.sig);
+  } else {
+    const bool is_valid = ml_dsa::verify<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(keypair.pubkey, keypair.msg, keypair.sig);
+    benchmark::DoNotOptimize(is_valid);
+  }
+}
+
+// Measures single-threaded throughput ( in operations per second ) of given operation, once per process.
+template<ml_dsa_runtime::param_set_t param_set, op_t op>
+static double
+baseline_throughput(const keypair_t<param_set>& keypair)
+{
+  static std::once_flag once;
+  static double throughput = 0;
+
+  std::call_once(once, [&]() {
+    ml_dsa_prng::prng_t<256> prng;
+    keypair_t<param_set> out(prng);
+    std::array<uint8_t, 32> seed{};
+
+    size_t ops = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    while ((t1 - t0) < CALIBRATION_TIME) {
+      run_op<param_set, op>(keypair, out, seed);
+      seed[0]++;
+      ops++;
+
+      t1 = std::chrono::steady_clock::now();
+    }
+
+    throughput = static_cast<double>(ops) / std::chrono::duration<double>(t1 - t0).count();
+  });
+
+  return throughput;
+}
+
+// Benchmark aggregate throughput of ML-DSA keygen/ sign/ verify, when run on multiple threads.
+template<ml_dsa_runtime::param_set_t param_set, op_t op, keys_t keys>
+void
+throughput(benchmark::State& state)
+{
+  // Shared keypair is generated by whichever thread gets here first, thread-safe static initialization.
+  static const auto shared_keypair = []() {
+    ml_dsa_prng::prng_t<256> prng;
+    return std::make_unique<keypair_t<param_set>>(prng);
+  }();
+
+  ml_dsa_prng::prng_t<256> prng;
+  auto own_keypair = std::make_unique<keypair_t<param_set>>(prng);
+  auto out = std::make_unique<keypair_t<param_set>>(prng);
+
+  const auto& keypair = (keys == keys_t::shared) ? *shared_keypair : *own_keypair;
+  const double baseline = baseline_throughput<param_set, op>(keypair);
+
+  std::array<uint8_t, 32> seed{};
+  prng.read(seed);
+
+  const auto t0 = std::chrono::steady_clock::now();
+
+  for (auto _ : state) {
+    run_op<param_set, op>(keypair, *out, seed);
+    seed[0]++;
+
+    benchmark::DoNotOptimize(seed);
+    benchmark::DoNotOptimize(*out);
+    benchmark::ClobberMemory();
+  }
+
+  const auto t1 = std::chrono::steady_clock::now();
+  const double own_throughput = static_cast<double>(state.iterations()) / std::chrono::duration<double>(t1 - t0).count();
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["efficiency"] = benchmark::Counter(own_throughput / baseline, benchmark::Counter::kAvgThreads);
+}
+
+#define BENCHMARK_THROUGHPUT(ps, op, keys)                                                                                                                     \
+  BENCHMARK(throughput<ml_dsa_runtime::param_set_t::ps, op_t::op, keys_t::keys>)                                                                               \
+    ->Name(#ps "/" #op "_throughput/" #keys "_keys")                                                                                                           \
+    ->ThreadRange(1, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())))                                                                      \
+    ->UseRealTime()                                                                                                                                            \
+    ->ComputeStatistics("min", compute_min)                                                                                                                    \
+    ->ComputeStatistics("max", compute_max)
+
+// Key generation doesn't consume any key, hence it's only benchmarked with independent keys.
+#define BENCHMARK_THROUGHPUTS(ps)                                                                                                                              \
+  BENCHMARK_THROUGHPUT(ps, keygen, independent);                                                                                                               \
+  BENCHMARK_THROUGHPUT(ps, sign, shared);                                                                                                                      \
+  BENCHMARK_THROUGHPUT(ps, sign, independent);                                                                                                                 \
+  BENCHMARK_THROUGHPUT(ps, verify, shared);                                                                                                                    \
+  BENCHMARK_THROUGHPUT(ps, verify, independent);
+
+BENCHMARK_THROUGHPUTS(ml_dsa_44);
+BENCHMARK_THROUGHPUTS(ml_dsa_65);
+BENCHMARK_THROUGHPUTS(ml_dsa_87);
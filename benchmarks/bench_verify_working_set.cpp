@@ -0,0 +1,223 @@
+#include "bench_helper.hpp"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#if defined __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Cache-cold, many-keys signature verification benchmark
+//
+// Verification servers rotate through many public keys, so unlike the verify benchmark of `bench_ml_dsa_*.cpp`, which
+// verifies the same ( public key, signature ) pair over and over, following benchmarks verify signatures over a
+// working set of distinct ( public key, message, signature ) triples, visited in random order. Working set sizes are
+// 10^3, 10^4 and 10^5 triples by default, which can be overridden using environment variable
+// `ML_DSA_VERIFY_WORKING_SETS`, holding comma separated sizes, e.g. `ML_DSA_VERIFY_WORKING_SETS=1000,1000000`. Note,
+// generating the working set takes about 1ms and ~4-7KB of memory per triple.
+//
+// Along with throughput, last level cache misses per verification are reported, as `llc_misses`, on Linux, as long as
+// hardware performance counters are accessible ( see /proc/sys/kernel/perf_event_paranoid ).
+
+// Counts last level cache misses of the calling thread, using perf_event_open(2), when available.
+struct llc_miss_counter_t
+{
+  int fd = -1;
+
+  llc_miss_counter_t()
+  {
+#if defined __linux__
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+
+  ~llc_miss_counter_t()
+  {
+#if defined __linux__
+    if (fd >= 0) {
+      close(fd);
+    }
+#endif
+  }
+
+  bool available() const { return fd >= 0; }
+
+  void start()
+  {
+#if defined __linux__
+    if (available()) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  uint64_t stop()
+  {
+    uint64_t cnt = 0;
+#if defined __linux__
+    if (available()) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &cnt, sizeof(cnt)) != sizeof(cnt)) {
+        cnt = 0;
+      }
+    }
+#endif
+    return cnt;
+  }
+};
+
+// Working set of distinct ( public key, message, signature ) triples of a parameter set, grown on demand and shared by
+// all benchmarks of that parameter set, so that it's generated only once.
+template<ml_dsa_runtime::param_set_t param_set>
+struct working_set_t
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+
+  static constexpr size_t PUBKEY_LEN = ml_dsa_utils::pub_key_len(p::k, p::d);
+  static constexpr size_t SECKEY_LEN = ml_dsa_utils::sec_key_len(p::k, p::l, p::η, p::d);
+  static constexpr size_t SIG_LEN = ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ);
+  static constexpr size_t MSG_LEN = 32;
+
+  std::vector<std::array<uint8_t, PUBKEY_LEN>> pubkeys;
+  std::vector<std::array<uint8_t, MSG_LEN>> msgs;
+  std::vector<std::array<uint8_t, SIG_LEN>> sigs;
+
+  ml_dsa_prng::prng_t<256> prng;
+
+  static working_set_t& instance()
+  {
+    static working_set_t ws;
+    return ws;
+  }
+
+  void grow(const size_t n)
+  {
+    if (pubkeys.size() >= n) {
+      return;
+    }
+
+    const size_t from = pubkeys.size();
+
+    pubkeys.resize(n);
+    msgs.resize(n);
+    sigs.resize(n);
+
+    std::array<uint8_t, ml_dsa::KEYGEN_SEED_BYTE_LEN> seed{};
+    std::array<uint8_t, ml_dsa::RND_BYTE_LEN> rnd{};
+    std::array<uint8_t, SECKEY_LEN> seckey{};
+
+    for (size_t i = from; i < n; i++) {
+      prng.read(seed);
+      prng.read(rnd);
+      prng.read(msgs[i]);
+
+      ml_dsa::keygen<p::k, p::l, p::d, p::η>(seed, pubkeys[i], seckey);
+      ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, seckey, msgs[i], sigs[i]);
+    }
+  }
+};
+
+// Benchmark throughput of ML-DSA signature verification, over a working set of `state.range(0)` distinct triples.
+template<ml_dsa_runtime::param_set_t param_set>
+void
+verify_working_set(benchmark::State& state)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  using ws_t = working_set_t<param_set>;
+
+  const size_t n = static_cast<size_t>(state.range(0));
+
+  auto& ws = ws_t::instance();
+  ws.grow(n);
+
+  // Visit triples in random order, so that hardware prefetchers can't hide cache misses.
+  std::vector<uint32_t> order(n);
+  std::iota(order.begin(), order.end(), 0u);
+  for (size_t i = n - 1; i > 0; i--) {
+    std::array<uint8_t, 8> rnd{};
+    ws.prng.read(rnd);
+
+    size_t j = 0;
+    std::memcpy(&j, rnd.data(), sizeof(j));
+    std::swap(order[i], order[j % (i + 1)]);
+  }
+
+  llc_miss_counter_t llc_misses;
+  uint64_t total_llc_misses = 0;
+
+  size_t idx = 0;
+  for (auto _ : state) {
+    const size_t i = order[idx];
+
+    llc_misses.start();
+    const bool is_valid = ml_dsa::verify<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(ws.pubkeys[i], ws.msgs[i], ws.sigs[i]);
+    total_llc_misses += llc_misses.stop();
+
+    benchmark::DoNotOptimize(is_valid);
+    benchmark::ClobberMemory();
+
+    idx = (idx + 1 == n) ? 0 : idx + 1;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * (ws_t::PUBKEY_LEN + ws_t::MSG_LEN + ws_t::SIG_LEN));
+  state.counters["working_set_MiB"] = static_cast<double>(n * (ws_t::PUBKEY_LEN + ws_t::MSG_LEN + ws_t::SIG_LEN)) / (1024. * 1024.);
+
+  if (llc_misses.available()) {
+    state.counters["llc_misses"] = benchmark::Counter(static_cast<double>(total_llc_misses), benchmark::Counter::kAvgIterations);
+  }
+}
+
+// Returns working set sizes, from environment variable `ML_DSA_VERIFY_WORKING_SETS`, if set, otherwise defaults.
+static std::vector<int64_t>
+working_set_sizes()
+{
+  const char* const env = std::getenv("ML_DSA_VERIFY_WORKING_SETS");
+  if (env == nullptr) {
+    return { 1'000, 10'000, 100'000 };
+  }
+
+  std::vector<int64_t> sizes;
+  const std::string list(env);
+
+  size_t from = 0;
+  while (from < list.size()) {
+    const size_t till = std::min(list.find(',', from), list.size());
+    const int64_t size = std::atoll(list.substr(from, till - from).c_str());
+
+    if (size > 0) {
+      sizes.push_back(size);
+    }
+    from = till + 1;
+  }
+
+  return sizes;
+}
+
+#define BENCHMARK_VERIFY_WORKING_SET(ps)                                                                                                                       \
+  BENCHMARK(verify_working_set<ml_dsa_runtime::param_set_t::ps>)                                                                                               \
+    ->Name(#ps "/verify_working_set")                                                                                                                          \
+    ->ArgsProduct({ working_set_sizes() })                                                                                                                     \
+    ->ComputeStatistics("min", compute_min)                                                                                                                    \
+    ->ComputeStatistics("max", compute_max)
+
+BENCHMARK_VERIFY_WORKING_SET(ml_dsa_44);
+BENCHMARK_VERIFY_WORKING_SET(ml_dsa_65);
+BENCHMARK_VERIFY_WORKING_SET(ml_dsa_87);
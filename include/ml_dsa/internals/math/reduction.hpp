@@ -36,28 +36,59 @@ power2round(const ml_dsa_field::zq_t r)
 //
 // If r1 = (q - 1)/ α then r1 = 0; r0 = r0 - 1
 //
+// For both of the α values used by ML-DSA i.e. 2 * (q - 1)/ 88 and 2 * (q - 1)/ 32, r1 is computed without division,
+// using a multiply-and-shift by a precomputed reciprocal, which also takes care of above wrap-around case. This routine
+// doesn't branch on input, so that it's constant-time and can be auto-vectorized when applied over a polynomial.
+//
 // See algorithm 30 of ML-DSA specification https://doi.org/10.6028/NIST.FIPS.204.ipd.
+// Reciprocal constants are collected from
+// https://github.com/pq-crystals/dilithium/blob/3e9b9f1/ref/rounding.c#L25-L53.
 template<uint32_t alpha>
 static inline constexpr std::pair<ml_dsa_field::zq_t, ml_dsa_field::zq_t>
 decompose(const ml_dsa_field::zq_t r)
 {
-  constexpr uint32_t t0 = alpha >> 1;
-  constexpr uint32_t t1 = ml_dsa_field::Q - 1u;
+  if constexpr ((alpha == 2 * ((ml_dsa_field::Q - 1u) / 32u)) || (alpha == 2 * ((ml_dsa_field::Q - 1u) / 88u))) {
+    const uint32_t t0 = (r.raw() + 127u) >> 7;
+    uint32_t r1 = 0;
+
+    if constexpr (alpha == 2 * ((ml_dsa_field::Q - 1u) / 32u)) {
+      // r1 ∈ [0, 16], where r1 = 16 wraps around to 0, by masking
+      r1 = ((t0 * 1025u + (1u << 21)) >> 22) & 15u;
+    } else {
+      // r1 ∈ [0, 44], where r1 = 44 wraps around to 0
+      r1 = (t0 * 11275u + (1u << 23)) >> 24;
+      r1 ^= (-((43u - r1) >> 31)) & r1;
+    }
+
+    // r0 ∈ (-α/2, α/2], unless wrapped around, when it's r - q
+    const uint32_t t1 = r.raw() - r1 * alpha;
+    const uint32_t t2 = -(((ml_dsa_field::Q - 1u) / 2u - t1) >> 31);
+    const uint32_t t3 = t1 - (t2 & ml_dsa_field::Q);
+
+    // Keep r0 in canonical form, as an element ∈ Z_q
+    const uint32_t t4 = -(t3 >> 31);
+    const uint32_t r0 = t3 + (t4 & ml_dsa_field::Q);
+
+    return std::make_pair(ml_dsa_field::zq_t{ r1 }, ml_dsa_field::zq_t{ r0 });
+  } else {
+    constexpr uint32_t t0 = alpha >> 1;
+    constexpr uint32_t t1 = ml_dsa_field::Q - 1u;
 
-  const uint32_t t2 = r.raw() + t0 - 1u;
-  const uint32_t t3 = t2 / alpha;
-  const uint32_t t4 = t3 * alpha;
+    const uint32_t t2 = r.raw() + t0 - 1u;
+    const uint32_t t3 = t2 / alpha;
+    const uint32_t t4 = t3 * alpha;
 
-  const ml_dsa_field::zq_t r0 = r - ml_dsa_field::zq_t{ t4 };
-  const ml_dsa_field::zq_t t5 = r - r0;
+    const ml_dsa_field::zq_t r0 = r - ml_dsa_field::zq_t{ t4 };
+    const ml_dsa_field::zq_t t5 = r - r0;
 
-  const bool flg = !static_cast<bool>(t5.raw() ^ t1);
-  const ml_dsa_field::zq_t br[]{ ml_dsa_field::zq_t(t5.raw() / alpha), ml_dsa_field::zq_t::zero() };
+    const bool flg = !static_cast<bool>(t5.raw() ^ t1);
+    const ml_dsa_field::zq_t br[]{ ml_dsa_field::zq_t(t5.raw() / alpha), ml_dsa_field::zq_t::zero() };
 
-  const ml_dsa_field::zq_t r1 = br[flg];
-  const ml_dsa_field::zq_t r0_ = r0 - ml_dsa_field::zq_t{ 1u * flg };
+    const ml_dsa_field::zq_t r1 = br[flg];
+    const ml_dsa_field::zq_t r0_ = r0 - ml_dsa_field::zq_t{ 1u * flg };
 
-  return std::make_pair(r1, r0_);
+    return std::make_pair(r1, r0_);
+  }
 }
 
 // Given an element ∈ Z_q, this routine extracts out high order bits of r.
@@ -95,6 +126,26 @@ make_hint(const ml_dsa_field::zq_t z, const ml_dsa_field::zq_t r)
   return ml_dsa_field::zq_t{ static_cast<uint32_t>(r1 != v1) };
 }
 
+// Given low order bits `r0` of `w - cs2 + ct0` and high order bits `r1` of `w`, this routine computes the same 1 -bit hint
+// as `make_hint(-ct0, w - cs2 + ct0)`, without decomposing anything, as long as ||LowBits(w) - cs2||∞ < γ2 - β and
+// ||ct0||∞ < γ2 hold, which is always the case when the signing procedure computes hint bits.
+//
+// Hint bit is set when `r0` falls out of (-γ2, γ2], or it's -γ2 while `r1` is non-zero.
+//
+// This implementation collects some ideas from
+// https://github.com/pq-crystals/dilithium/blob/3e9b9f1/ref/rounding.c#L55-L75.
+template<uint32_t alpha>
+static inline constexpr ml_dsa_field::zq_t
+make_hint_decomposed(const ml_dsa_field::zq_t r0, const ml_dsa_field::zq_t r1)
+{
+  constexpr uint32_t γ2 = alpha >> 1;
+
+  const bool flg0 = (r0.raw() > γ2) & (r0.raw() < (ml_dsa_field::Q - γ2));
+  const bool flg1 = (r0.raw() == (ml_dsa_field::Q - γ2)) & (r1.raw() != 0u);
+
+  return ml_dsa_field::zq_t{ static_cast<uint32_t>(flg0 | flg1) };
+}
+
 // 1 -bit hint ( read `h` ) is used to recover higher order bits of `r + z`.
 // See algorithm 34 of ML-DSA algorithm https://doi.org/10.6028/NIST.FIPS.204.ipd.
 template<uint32_t alpha>
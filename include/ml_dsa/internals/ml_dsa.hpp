@@ -2,9 +2,13 @@
 #include "ml_dsa/internals/math/field.hpp"
 #include "ml_dsa/internals/poly/polyvec.hpp"
 #include "ml_dsa/internals/poly/sampling.hpp"
+#include "ml_dsa/internals/prehash.hpp"
+#include "ml_dsa/internals/utility/instrument.hpp"
 #include "ml_dsa/internals/utility/params.hpp"
+#include "ml_dsa/internals/utility/probes.hpp"
 #include "ml_dsa/internals/utility/utils.hpp"
 #include <algorithm>
+#include <type_traits>
 
 // ML-DSA FIPS 204
 namespace ml_dsa {
@@ -15,6 +19,20 @@ static constexpr size_t KEYGEN_SEED_BYTE_LEN = 32;
 // Byte length of randomness, required for hedged signing.
 static constexpr size_t RND_BYTE_LEN = 32;
 
+// Byte length of message representative μ, which is what actually gets signed.
+static constexpr size_t MU_BYTE_LEN = 64;
+
+// Maximum byte length of context string, a signature can be bound to.
+static constexpr size_t MAX_CTX_BYTE_LEN = 255;
+
+// Domain separator, starting the formatted message M', which tells pure ML-DSA ( signing the message itself ) apart
+// from HashML-DSA ( signing pre-hash of the message ), see section 5.4 of FIPS 204.
+enum class domain_t : uint8_t
+{
+  pure = 0,
+  prehash = 1,
+};
+
 // Given seed ξ, this routine generates a public key and secret key pair, using deterministic key generation algorithm.
 //
 // See algorithm 1 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
@@ -25,42 +43,50 @@ keygen(std::span<const uint8_t, KEYGEN_SEED_BYTE_LEN> ξ,
        std::span<uint8_t, ml_dsa_utils::sec_key_len(k, l, η, d)> seckey)
   requires(ml_dsa_params::check_keygen_params(k, l, d, η))
 {
+  using stage_t = ml_dsa_instrument::stage_t;
+  ml_dsa_instrument::record_call(ml_dsa_instrument::op_t::keygen);
+  ML_DSA_PROBE(keygen__entry, ml_dsa_probes::PARAM_SET<k, l>);
+
   std::array<uint8_t, 32 + 64 + 32> seed_hash{};
   auto seed_hash_span = std::span(seed_hash);
 
   shake256::shake256_t hasher;
-  hasher.absorb(ξ);
-  hasher.finalize();
-  hasher.squeeze(seed_hash_span);
+  ml_dsa_instrument::measure<stage_t::hashing>([&]() {
+    hasher.absorb(ξ);
+    hasher.finalize();
+    hasher.squeeze(seed_hash_span);
+  });
 
   auto rho = seed_hash_span.template first<32>();
   auto rho_prime = seed_hash_span.template subspan<rho.size(), 64>();
   auto key = seed_hash_span.template last<32>();
 
   std::array<ml_dsa_field::zq_t, k * l * ml_dsa_ntt::N> A{};
-  ml_dsa_sampling::expand_a<k, l>(rho, A);
+  ml_dsa_instrument::measure<stage_t::expand_a>([&]() { ml_dsa_sampling::expand_a<k, l>(rho, A); });
 
   std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> s1{};
   std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> s2{};
 
-  ml_dsa_sampling::expand_s<η, l, 0>(rho_prime, s1);
-  ml_dsa_sampling::expand_s<η, k, l>(rho_prime, s2);
+  ml_dsa_instrument::measure<stage_t::expand_s>([&]() {
+    ml_dsa_sampling::expand_s<η, l, 0>(rho_prime, s1);
+    ml_dsa_sampling::expand_s<η, k, l>(rho_prime, s2);
+  });
 
   std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> s1_prime{};
 
   std::copy(s1.begin(), s1.end(), s1_prime.begin());
-  ml_dsa_polyvec::ntt<l>(s1_prime);
+  ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::ntt<l>(s1_prime); });
 
   std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> t{};
 
-  ml_dsa_polyvec::matrix_multiply<k, l, l, 1>(A, s1_prime, t);
-  ml_dsa_polyvec::intt<k>(t);
+  ml_dsa_instrument::measure<stage_t::matrix_multiply>([&]() { ml_dsa_polyvec::matrix_multiply<k, l, l, 1>(A, s1_prime, t); });
+  ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::intt<k>(t); });
   ml_dsa_polyvec::add_to<k>(s2, t);
 
   std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> t1{};
   std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> t0{};
 
-  ml_dsa_polyvec::power2round<k, d>(t, t1, t0);
+  ml_dsa_instrument::measure<stage_t::hint>([&]() { ml_dsa_polyvec::power2round<k, d>(t, t1, t0); });
 
   constexpr size_t t1_bw = std::bit_width(ml_dsa_field::Q) - d;
   std::array<uint8_t, 64> tr{};
@@ -71,13 +97,15 @@ keygen(std::span<const uint8_t, KEYGEN_SEED_BYTE_LEN> ξ,
   constexpr size_t pkoff2 = pubkey.size();
 
   std::copy(rho.begin(), rho.end(), pubkey.begin());
-  ml_dsa_polyvec::encode<k, t1_bw>(t1, pubkey.template last<pkoff2 - pkoff1>());
+  ml_dsa_instrument::measure<stage_t::packing>([&]() { ml_dsa_polyvec::encode<k, t1_bw>(t1, pubkey.template last<pkoff2 - pkoff1>()); });
 
   // Prepare secret key
-  hasher.reset();
-  hasher.absorb(pubkey);
-  hasher.finalize();
-  hasher.squeeze(tr);
+  ml_dsa_instrument::measure<stage_t::hashing>([&]() {
+    hasher.reset();
+    hasher.absorb(pubkey);
+    hasher.finalize();
+    hasher.squeeze(tr);
+  });
 
   constexpr size_t eta_bw = std::bit_width(2 * η);
   constexpr size_t s1_len = l * eta_bw * 32;
@@ -95,34 +123,61 @@ keygen(std::span<const uint8_t, KEYGEN_SEED_BYTE_LEN> ξ,
   std::copy(key.begin(), key.end(), seckey.template subspan<skoff1, skoff2 - skoff1>().begin());
   std::copy(tr.begin(), tr.end(), seckey.template subspan<skoff2, skoff3 - skoff2>().begin());
 
-  ml_dsa_polyvec::sub_from_x<l, η>(s1);
-  ml_dsa_polyvec::sub_from_x<k, η>(s2);
-
-  ml_dsa_polyvec::encode<l, eta_bw>(s1, seckey.template subspan<skoff3, skoff4 - skoff3>());
-  ml_dsa_polyvec::encode<k, eta_bw>(s2, seckey.template subspan<skoff4, skoff5 - skoff4>());
-
   constexpr uint32_t t0_rng = 1u << (d - 1);
 
-  ml_dsa_polyvec::sub_from_x<k, t0_rng>(t0);
-  ml_dsa_polyvec::encode<k, d>(t0, seckey.template subspan<skoff5, skoff6 - skoff5>());
+  ml_dsa_instrument::measure<stage_t::packing>([&]() {
+    ml_dsa_polyvec::encode_centered<l, eta_bw, η>(s1, seckey.template subspan<skoff3, skoff4 - skoff3>());
+    ml_dsa_polyvec::encode_centered<k, eta_bw, η>(s2, seckey.template subspan<skoff4, skoff5 - skoff4>());
+    ml_dsa_polyvec::encode_centered<k, d, t0_rng>(t0, seckey.template subspan<skoff5, skoff6 - skoff5>());
+  });
+
+  ML_DSA_PROBE(keygen__return, ml_dsa_probes::PARAM_SET<k, l>);
 }
 
-// Given a ML-DSA secret key and message (can be empty too), this routine computes a hedged/ deterministic signature.
+// ML-DSA secret key, expanded into the form consumed by the signing procedure i.e. public matrix A and vectors s1, s2,
+// t0, all in their NTT representation, along with public key hash tr and key K. Preparing it once lets a signer skip
+// matrix expansion and secret key decoding, when signing many messages with the same key.
 //
-// Notice, first parameter of this function, `rnd`, which lets you pass 32 -bytes randomness for generating default
-// "hedged" signature. In case you don't need randomized message signature, you can instead fill `rnd` with zeros, and
-// it'll generate a deterministic signature.
+// Each member starts at a cache-line boundary, so that the structure can be used, in place, from a memory-mapped
+// image, see `ml_dsa_image`.
+template<size_t k, size_t l>
+struct alignas(64) prepared_seckey_t
+{
+  std::array<ml_dsa_field::zq_t, k * l * ml_dsa_ntt::N> A{};
+  std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> s1{};
+  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> s2{};
+  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> t0{};
+  std::array<uint8_t, 64> tr{};
+  std::array<uint8_t, 32> key{};
+};
+
+// ML-DSA public key, expanded into the form consumed by the verification procedure i.e. public matrix A and vector
+// t1 x 2^d, both in their NTT representation, along with public key hash tr. Preparing it once lets a verifier skip
+// matrix expansion, t1 decoding and public key hashing, when verifying many signatures under the same key.
 //
-// Note, hedged signing is the default and recommended version.
+// When `packed` is set, coefficients of matrix A are stored using 23 -bits each ( as Q < 2^23 ), instead of 32 -bits,
+// which makes prepared public key ~28% smaller, so that many more of them fit in a cache of prepared keys ( or in L3 ),
+// at the cost of unpacking A while multiplying by it.
 //
-// See algorithm 2 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
-template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+// Each member starts at a cache-line boundary, so that the structure can be used, in place, from a memory-mapped
+// image, see `ml_dsa_image`.
+template<size_t k, size_t l, bool packed = false>
+struct alignas(64) prepared_pubkey_t
+{
+  static constexpr size_t PACKED_A_BYTE_LEN = (k * l * ml_dsa_field::Q_BIT_WIDTH * ml_dsa_ntt::N) / std::numeric_limits<uint8_t>::digits;
+  using matrix_t = std::conditional_t<packed, std::array<uint8_t, PACKED_A_BYTE_LEN>, std::array<ml_dsa_field::zq_t, k * l * ml_dsa_ntt::N>>;
+
+  matrix_t A{};
+  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> t1{};
+  std::array<uint8_t, 64> tr{};
+};
+
+// Given a ML-DSA secret key, this routine expands it into a prepared secret key, decoding each of s1, s2 and t0
+// polynomials and moving it to NTT domain, in a single pass.
+template<size_t k, size_t l, size_t d, uint32_t η>
 static inline constexpr void
-sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
-     std::span<const uint8_t, ml_dsa_utils::sec_key_len(k, l, η, d)> seckey,
-     std::span<const uint8_t> msg,
-     std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
-  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+prepare_seckey(std::span<const uint8_t, ml_dsa_utils::sec_key_len(k, l, η, d)> seckey, prepared_seckey_t<k, l>& prepared)
+  requires(ml_dsa_params::check_keygen_params(k, l, d, η))
 {
   constexpr uint32_t t0_rng = 1u << (d - 1);
 
@@ -141,48 +196,238 @@ sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
   auto key = seckey.template subspan<skoff1, skoff2 - skoff1>();
   auto tr = seckey.template subspan<skoff2, skoff3 - skoff2>();
 
-  std::array<ml_dsa_field::zq_t, k * l * ml_dsa_ntt::N> A{};
-  ml_dsa_sampling::expand_a<k, l>(rho, A);
+  using stage_t = ml_dsa_instrument::stage_t;
+  ML_DSA_PROBE(prepare_seckey__entry, ml_dsa_probes::PARAM_SET<k, l>);
+
+  ml_dsa_instrument::measure<stage_t::expand_a>([&]() { ml_dsa_sampling::expand_a<k, l>(rho, prepared.A); });
+
+  std::copy(key.begin(), key.end(), prepared.key.begin());
+  std::copy(tr.begin(), tr.end(), prepared.tr.begin());
+
+  ml_dsa_instrument::measure<stage_t::decode_seckey>([&]() {
+    ml_dsa_polyvec::decode_centered_ntt<l, eta_bw, η>(seckey.template subspan<skoff3, skoff4 - skoff3>(), prepared.s1);
+    ml_dsa_polyvec::decode_centered_ntt<k, eta_bw, η>(seckey.template subspan<skoff4, skoff5 - skoff4>(), prepared.s2);
+    ml_dsa_polyvec::decode_centered_ntt<k, d, t0_rng>(seckey.template subspan<skoff5, seckey.size() - skoff5>(), prepared.t0);
+  });
+
+  ML_DSA_PROBE(prepare_seckey__return, ml_dsa_probes::PARAM_SET<k, l>);
+}
 
-  std::array<uint8_t, 64> mu{};
-  auto mu_span = std::span(mu);
+// Given a ML-DSA public key, this routine expands it into a prepared public key, sampling matrix A, decoding t1 and
+// moving t1 x 2^d to NTT domain, along with hashing the public key.
+template<size_t k, size_t l, size_t d, bool packed>
+static inline constexpr void
+prepare_pubkey(std::span<const uint8_t, ml_dsa_utils::pub_key_len(k, d)> pubkey, prepared_pubkey_t<k, l, packed>& prepared)
+{
+  constexpr size_t t1_bw = std::bit_width(ml_dsa_field::Q) - d;
 
+  constexpr size_t pkoff0 = 0;
+  constexpr size_t pkoff1 = pkoff0 + 32;
+  constexpr size_t pkoff2 = pubkey.size();
+
+  auto rho = pubkey.template subspan<pkoff0, pkoff1 - pkoff0>();
+  auto t1_encoded = pubkey.template subspan<pkoff1, pkoff2 - pkoff1>();
+
+  using stage_t = ml_dsa_instrument::stage_t;
+  ML_DSA_PROBE(prepare_pubkey__entry, ml_dsa_probes::PARAM_SET<k, l>);
+
+  if constexpr (packed) {
+    std::array<ml_dsa_field::zq_t, k * l * ml_dsa_ntt::N> A{};
+
+    ml_dsa_instrument::measure<stage_t::expand_a>([&]() { ml_dsa_sampling::expand_a<k, l>(rho, A); });
+    ml_dsa_instrument::measure<stage_t::packing>([&]() { ml_dsa_polyvec::encode<k * l, ml_dsa_field::Q_BIT_WIDTH>(A, prepared.A); });
+  } else {
+    ml_dsa_instrument::measure<stage_t::expand_a>([&]() { ml_dsa_sampling::expand_a<k, l>(rho, prepared.A); });
+  }
+  ml_dsa_instrument::measure<stage_t::packing>([&]() { ml_dsa_polyvec::decode<k, t1_bw>(t1_encoded, prepared.t1); });
+
+  ml_dsa_polyvec::shl<k, d>(prepared.t1);
+  ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::ntt<k>(prepared.t1); });
+
+  ml_dsa_instrument::measure<stage_t::hashing>([&]() {
+    shake256::shake256_t hasher;
+    hasher.absorb(pubkey);
+    hasher.finalize();
+    hasher.squeeze(prepared.tr);
+  });
+
+  ML_DSA_PROBE(prepare_pubkey__return, ml_dsa_probes::PARAM_SET<k, l>);
+}
+
+// Given public key hash tr ( = H(pubkey, 64) ) and message (can be empty too), this routine computes message
+// representative μ = H(tr || M, 64). It lets a party holding the message, but not the secret key, compute μ and hand
+// it over to the signer, see `sign_mu`.
+static inline constexpr void
+compute_mu(std::span<const uint8_t, 64> tr, std::span<const uint8_t> msg, std::span<uint8_t, MU_BYTE_LEN> mu)
+{
   shake256::shake256_t hasher;
   hasher.absorb(tr);
   hasher.absorb(msg);
   hasher.finalize();
-  hasher.squeeze(mu_span);
+  hasher.squeeze(mu);
+}
 
-  std::array<uint8_t, 64> rho_prime{};
+// SHAKE256 state, right after absorbing public key hash tr and a prefix, shared by many messages ( say a fixed protocol
+// header ), so that μ of each of those messages is computed by absorbing only what follows the prefix. It remembers tr,
+// so that it isn't used with a key, it wasn't computed for.
+struct mu_prefix_t
+{
+  shake256::shake256_t hasher{};
+  std::array<uint8_t, 64> tr{};
+  size_t prefix_len = 0;
+};
+
+// Given public key hash tr and a message prefix, this routine absorbs tr || prefix into a fresh SHAKE256 state, which
+// can then be cloned for computing μ of any message starting with that prefix, see `compute_mu` taking a `mu_prefix_t`.
+static inline constexpr void
+absorb_prefix(std::span<const uint8_t, 64> tr, std::span<const uint8_t> prefix, mu_prefix_t& state)
+{
+  state.hasher = shake256::shake256_t{};
+  state.hasher.absorb(tr);
+  state.hasher.absorb(prefix);
 
-  hasher.reset();
-  hasher.absorb(key);
-  hasher.absorb(rnd);
-  hasher.absorb(mu_span);
+  std::copy(tr.begin(), tr.end(), state.tr.begin());
+  state.prefix_len = prefix.size();
+}
+
+// Given SHAKE256 state after absorbing tr || prefix ( see `absorb_prefix` ) and rest of the message, this routine
+// computes μ = H(tr || prefix || suffix, 64), same as `compute_mu` does for the whole message, by absorbing only the
+// suffix into a copy of the state.
+static inline constexpr void
+compute_mu(const mu_prefix_t& state, std::span<const uint8_t> suffix, std::span<uint8_t, MU_BYTE_LEN> mu)
+{
+  auto hasher = state.hasher;
+  hasher.absorb(suffix);
   hasher.finalize();
-  hasher.squeeze(rho_prime);
+  hasher.squeeze(mu);
+}
 
-  std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> s1{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> s2{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> t0{};
+// Given domain separator and context string ( of at most 255 -bytes ), this routine absorbs domain || len(ctx) || ctx,
+// which starts the formatted message M', into a SHAKE256 state, which has already absorbed public key hash tr.
+static inline constexpr void
+absorb_ctx(shake256::shake256_t& hasher, const domain_t domain, std::span<const uint8_t> ctx)
+{
+  const std::array<uint8_t, 2> header = { static_cast<uint8_t>(domain), static_cast<uint8_t>(ctx.size()) };
+
+  hasher.absorb(header);
+  hasher.absorb(ctx);
+}
+
+// Given public key hash tr, context string ( of at most 255 -bytes, can be empty ) and message (can be empty too), this
+// routine computes message representative μ = H(tr || 0 || len(ctx) || ctx || M, 64), absorbing the context string and
+// the message right from where they are, without concatenating them. Returns false, if context string is too long.
+//
+// See algorithm 2 of ML-DSA standard @ https://doi.org/10.6028/NIST.FIPS.204.
+static inline constexpr bool
+compute_mu(std::span<const uint8_t, 64> tr, std::span<const uint8_t> ctx, std::span<const uint8_t> msg, std::span<uint8_t, MU_BYTE_LEN> mu)
+{
+  if (ctx.size() > MAX_CTX_BYTE_LEN) {
+    return false;
+  }
+
+  shake256::shake256_t hasher;
+  hasher.absorb(tr);
+  absorb_ctx(hasher, domain_t::pure, ctx);
+  hasher.absorb(msg);
+  hasher.finalize();
+  hasher.squeeze(mu);
 
-  ml_dsa_polyvec::decode<l, eta_bw>(seckey.template subspan<skoff3, skoff4 - skoff3>(), s1);
-  ml_dsa_polyvec::decode<k, eta_bw>(seckey.template subspan<skoff4, skoff5 - skoff4>(), s2);
-  ml_dsa_polyvec::decode<k, d>(seckey.template subspan<skoff5, seckey.size() - skoff5>(), t0);
+  return true;
+}
+
+// Given public key hash tr, context string and a message prefix, this routine absorbs tr || 0 || len(ctx) || ctx ||
+// prefix into a fresh SHAKE256 state, so that signing or verifying any message, starting with that prefix, under that
+// context string, only absorbs what follows the prefix. Returns false, if context string is too long.
+static inline constexpr bool
+absorb_prefix(std::span<const uint8_t, 64> tr, std::span<const uint8_t> ctx, std::span<const uint8_t> prefix, mu_prefix_t& state)
+{
+  if (ctx.size() > MAX_CTX_BYTE_LEN) {
+    return false;
+  }
+
+  state.hasher = shake256::shake256_t{};
+  state.hasher.absorb(tr);
+  absorb_ctx(state.hasher, domain_t::pure, ctx);
+  state.hasher.absorb(prefix);
+
+  std::copy(tr.begin(), tr.end(), state.tr.begin());
+  state.prefix_len = prefix.size();
+
+  return true;
+}
+
+// Given public key hash tr, context string, a pre-hash function and digest of the message, computed using that
+// function ( see `ml_dsa_prehash` ), this routine computes message representative of HashML-DSA
+// μ = H(tr || 1 || len(ctx) || ctx || OID || PH(M), 64). Returns false, if context string is longer than 255 -bytes or
+// byte length of the digest doesn't match the pre-hash function.
+//
+// See algorithm 4 of ML-DSA standard @ https://doi.org/10.6028/NIST.FIPS.204.
+static inline constexpr bool
+compute_mu_prehash(std::span<const uint8_t, 64> tr,
+                   std::span<const uint8_t> ctx,
+                   const ml_dsa_prehash::hash_t hash,
+                   std::span<const uint8_t> digest,
+                   std::span<uint8_t, MU_BYTE_LEN> mu)
+{
+  const size_t digest_len = ml_dsa_prehash::digest_byte_len(hash);
+  if ((ctx.size() > MAX_CTX_BYTE_LEN) || (digest_len == 0) || (digest.size() != digest_len)) {
+    return false;
+  }
+
+  shake256::shake256_t hasher;
+  hasher.absorb(tr);
+  absorb_ctx(hasher, domain_t::prehash, ctx);
+  hasher.absorb(ml_dsa_prehash::oid(hash));
+  hasher.absorb(digest);
+  hasher.finalize();
+  hasher.squeeze(mu);
+
+  return true;
+}
+
+// Given a prepared ML-DSA secret key and message representative μ ( see `compute_mu` ), this routine computes a
+// hedged/ deterministic signature, same as `sign` does, when invoked with the message, μ was computed from. Byte
+// length of that message, if known, can be passed as `mlen`, which is only reported to tracing probes.
+//
+// Returns number of iterations of the rejection sampling loop, it took to produce the signature, which is useful for
+// studying signing latency distribution.
+//
+// See algorithm 2 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr size_t
+sign_mu(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+        const prepared_seckey_t<k, l>& prepared,
+        std::span<const uint8_t, MU_BYTE_LEN> mu,
+        std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig,
+        [[maybe_unused]] const size_t mlen = 0)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+{
+  const auto& A = prepared.A;
+  const auto& s1 = prepared.s1;
+  const auto& s2 = prepared.s2;
+  const auto& t0 = prepared.t0;
 
-  ml_dsa_polyvec::sub_from_x<l, η>(s1);
-  ml_dsa_polyvec::sub_from_x<k, η>(s2);
-  ml_dsa_polyvec::sub_from_x<k, t0_rng>(t0);
+  using stage_t = ml_dsa_instrument::stage_t;
+  using rejection_t = ml_dsa_instrument::rejection_t;
+  ml_dsa_instrument::record_call(ml_dsa_instrument::op_t::sign);
+  ML_DSA_PROBE(sign__entry, ml_dsa_probes::PARAM_SET<k, l>, mlen);
 
-  ml_dsa_polyvec::ntt<l>(s1);
-  ml_dsa_polyvec::ntt<k>(s2);
-  ml_dsa_polyvec::ntt<k>(t0);
+  std::array<uint8_t, 64> rho_prime{};
+
+  shake256::shake256_t hasher;
+  ml_dsa_instrument::measure<stage_t::hashing>([&]() {
+    hasher.absorb(prepared.key);
+    hasher.absorb(rnd);
+    hasher.absorb(mu);
+    hasher.finalize();
+    hasher.squeeze(rho_prime);
+  });
 
   bool has_signed = false;
   uint16_t kappa = 0;
 
   std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> z{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h{};
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> h{};
 
   std::array<uint8_t, (2 * λ) / std::numeric_limits<uint8_t>::digits> c_tilda{};
   auto c_tilda_span = std::span(c_tilda);
@@ -193,75 +438,112 @@ sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
     std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> y_prime{};
     std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w{};
 
-    ml_dsa_sampling::expand_mask<γ1, l>(rho_prime, kappa, y);
+    ml_dsa_instrument::record_iteration();
+    ml_dsa_instrument::measure<stage_t::expand_mask>([&]() { ml_dsa_sampling::expand_mask<γ1, l>(rho_prime, kappa, y); });
 
     std::copy(y.begin(), y.end(), y_prime.begin());
 
-    ml_dsa_polyvec::ntt<l>(y_prime);
-    ml_dsa_polyvec::matrix_multiply<k, l, l, 1>(A, y_prime, w);
-    ml_dsa_polyvec::intt<k>(w);
+    ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::ntt<l>(y_prime); });
+    ml_dsa_instrument::measure<stage_t::matrix_multiply>([&]() { ml_dsa_polyvec::matrix_multiply<k, l, l, 1>(A, y_prime, w); });
 
     constexpr uint32_t α = γ2 << 1;
     constexpr uint32_t m = (ml_dsa_field::Q - 1u) / α;
     constexpr size_t w1bw = std::bit_width(m - 1u);
+    constexpr size_t w1_poly_blen = w1bw * 32;
 
-    std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w1{};
-    std::array<uint8_t, k * w1bw * 32> w1_encoded{};
-
-    ml_dsa_polyvec::highbits<k, α>(w, w1);
-    ml_dsa_polyvec::encode<k, w1bw>(w1, w1_encoded);
+    std::array<uint8_t, k * w1_poly_blen> w1_encoded{};
 
     hasher.reset();
-    hasher.absorb(mu_span);
-    hasher.absorb(w1_encoded);
-    hasher.finalize();
-    hasher.squeeze(c_tilda_span);
+    hasher.absorb(mu);
+
+    // Each row of w is taken from NTT domain to serialized high order bits, which are absorbed into the hasher right
+    // away, while low order bits are kept in place of w, for rejection check and hint computation.
+    for (size_t i = 0; i < k; i++) {
+      const size_t off0 = i * ml_dsa_ntt::N;
+      const size_t off1 = i * w1_poly_blen;
+
+      auto w_row = std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N>(w.data() + off0, ml_dsa_ntt::N);
+      auto w1_row_encoded = std::span<uint8_t, w1_poly_blen>(w1_encoded.data() + off1, w1_poly_blen);
+
+      std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> w1_row{};
+
+      ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_ntt::intt(w_row); });
+      ml_dsa_instrument::measure<stage_t::hint>([&]() { ml_dsa_poly::decompose<α>(w_row, w1_row, w_row); });
+      ml_dsa_instrument::measure<stage_t::packing>([&]() { ml_dsa_bit_packing::encode<w1bw>(w1_row, w1_row_encoded); });
+      ml_dsa_instrument::measure<stage_t::hashing>([&]() { hasher.absorb(w1_row_encoded); });
+    }
+
+    ml_dsa_instrument::measure<stage_t::hashing>([&]() {
+      hasher.finalize();
+      hasher.squeeze(c_tilda_span);
+    });
 
     std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> c{};
 
-    ml_dsa_sampling::sample_in_ball<τ>(c1_tilda, c);
-    ml_dsa_ntt::ntt(c);
+    ml_dsa_instrument::measure<stage_t::sample_in_ball>([&]() { ml_dsa_sampling::sample_in_ball<τ>(c1_tilda, c); });
+    ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_ntt::ntt(c); });
 
-    ml_dsa_polyvec::mul_by_poly<l>(c, s1, z);
-    ml_dsa_polyvec::intt<l>(z);
+    ml_dsa_instrument::measure<stage_t::matrix_multiply>([&]() { ml_dsa_polyvec::mul_by_poly<l>(c, s1, z); });
+    ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::intt<l>(z); });
     ml_dsa_polyvec::add_to<l>(y, z);
 
-    std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> r0{};
-    std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> r1{};
+    std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> cs2{};
+
+    ml_dsa_instrument::measure<stage_t::matrix_multiply>([&]() { ml_dsa_polyvec::mul_by_poly<k>(c, s2, cs2); });
+    ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::intt<k>(cs2); });
+
+    // From here on, w holds LowBits(w) - cs2, whose infinity norm being < γ2 - β is equivalent to
+    // ||LowBits(w - cs2)||∞ < γ2 - β, because ||cs2||∞ <= β.
+    ml_dsa_polyvec::sub_from<k>(cs2, w);
 
-    ml_dsa_polyvec::mul_by_poly<k>(c, s2, r1);
-    ml_dsa_polyvec::intt<k>(r1);
-    ml_dsa_polyvec::neg<k>(r1);
-    ml_dsa_polyvec::add_to<k>(w, r1);
-    ml_dsa_polyvec::lowbits<k, α>(r1, r0);
+    ml_dsa_field::zq_t z_norm{};
+    ml_dsa_field::zq_t r0_norm{};
 
-    const ml_dsa_field::zq_t z_norm = ml_dsa_polyvec::infinity_norm<l>(z);
-    const ml_dsa_field::zq_t r0_norm = ml_dsa_polyvec::infinity_norm<k>(r0);
+    ml_dsa_instrument::measure<stage_t::norm_check>([&]() {
+      z_norm = ml_dsa_polyvec::infinity_norm<l>(z);
+      r0_norm = ml_dsa_polyvec::infinity_norm<k>(w);
+    });
 
-    constexpr ml_dsa_field::zq_t bound0(γ1 - β);
-    constexpr ml_dsa_field::zq_t bound1(γ2 - β);
+    const bool z_rejected = z_norm >= ml_dsa_field::zq_t(γ1 - β);
+    const bool r0_rejected = r0_norm >= ml_dsa_field::zq_t(γ2 - β);
 
-    if ((z_norm >= ml_dsa_field::zq_t(γ1 - β)) || (r0_norm >= ml_dsa_field::zq_t(γ2 - β))) {
+    if (z_rejected || r0_rejected) {
+      const rejection_t rejection = z_rejected ? rejection_t::z_norm : rejection_t::r0_norm;
+
+      ml_dsa_instrument::record_rejection(rejection);
+      ML_DSA_PROBE(sign__reject, ml_dsa_probes::PARAM_SET<k, l>, kappa, static_cast<uint32_t>(rejection));
       has_signed = false;
     } else {
-      std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h0{};
-      std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h1{};
+      std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> ct0{};
+
+      ml_dsa_instrument::measure<stage_t::matrix_multiply>([&]() { ml_dsa_polyvec::mul_by_poly<k>(c, t0, ct0); });
+      ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::intt<k>(ct0); });
+
+      // From here on, w holds LowBits(w) - cs2 + ct0, which along with HighBits(w) is enough for computing
+      // MakeHint(-ct0, w - cs2 + ct0), without decomposing anything. HighBits(w) is recovered from its serialized form,
+      // which is only required when this attempt is about to be accepted.
+      std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w1{};
+      ml_dsa_instrument::measure<stage_t::packing>([&]() { ml_dsa_polyvec::decode<k, w1bw>(w1_encoded, w1); });
 
-      ml_dsa_polyvec::mul_by_poly<k>(c, t0, h0);
-      ml_dsa_polyvec::intt<k>(h0);
+      ml_dsa_polyvec::add_to<k>(ct0, w);
+      ml_dsa_instrument::measure<stage_t::hint>([&]() { ml_dsa_polyvec::make_hint_decomposed<k, α>(w, w1, h); });
 
-      std::copy(h0.begin(), h0.end(), h1.begin());
+      ml_dsa_field::zq_t ct0_norm{};
+      size_t count_1s = 0;
 
-      ml_dsa_polyvec::neg<k>(h0);
-      ml_dsa_polyvec::add_to<k>(h1, r1);
-      ml_dsa_polyvec::make_hint<k, α>(h0, r1, h);
+      ml_dsa_instrument::measure<stage_t::norm_check>([&]() {
+        ct0_norm = ml_dsa_polyvec::infinity_norm<k>(ct0);
+        count_1s = ml_dsa_polyvec::count_1s<k>(h);
+      });
 
-      const ml_dsa_field::zq_t ct0_norm = ml_dsa_polyvec::infinity_norm<k>(h1);
-      const size_t count_1s = ml_dsa_polyvec::count_1s<k>(h);
+      const bool ct0_rejected = ct0_norm >= ml_dsa_field::zq_t(γ2);
+      const bool hint_rejected = count_1s > ω;
 
-      constexpr ml_dsa_field::zq_t bound2(γ2);
+      if (ct0_rejected || hint_rejected) {
+        const rejection_t rejection = ct0_rejected ? rejection_t::ct0_norm : rejection_t::hint_weight;
 
-      if ((ct0_norm >= ml_dsa_field::zq_t(γ2)) || (count_1s > ω)) {
+        ml_dsa_instrument::record_rejection(rejection);
+        ML_DSA_PROBE(sign__reject, ml_dsa_probes::PARAM_SET<k, l>, kappa, static_cast<uint32_t>(rejection));
         has_signed = false;
       } else {
         has_signed = true;
@@ -280,23 +562,186 @@ sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
 
   std::copy(c_tilda_span.begin(), c_tilda_span.end(), sig.template subspan<sigoff0, sigoff1 - sigoff0>().begin());
 
-  ml_dsa_polyvec::sub_from_x<l, γ1>(z);
-  ml_dsa_polyvec::encode<l, gamma1_bw>(z, sig.template subspan<sigoff1, sigoff2 - sigoff1>());
+  ml_dsa_instrument::measure<stage_t::packing>([&]() {
+    ml_dsa_polyvec::encode_centered<l, gamma1_bw, γ1>(z, sig.template subspan<sigoff1, sigoff2 - sigoff1>());
+    ml_dsa_bit_packing::encode_hint_bits<k, ω>(h, sig.template subspan<sigoff2, sigoff3 - sigoff2>());
+  });
 
-  ml_dsa_bit_packing::encode_hint_bits<k, ω>(h, sig.template subspan<sigoff2, sigoff3 - sigoff2>());
+  const size_t iterations = kappa / l;
+
+  ML_DSA_PROBE(sign__return, ml_dsa_probes::PARAM_SET<k, l>, mlen, iterations);
+  return iterations;
 }
 
-// Given a ML-DSA public key, message (can be empty too) and serialized signature, this routine verifies the correctness
-// of signature, returning boolean result, denoting status of signature verification. For example, say it returns true,
-// it means signature is valid for given message and public key.
+// Given a prepared ML-DSA secret key and message (can be empty too), this routine computes a hedged/ deterministic
+// signature, same as `sign` does, when invoked with the secret key, from which prepared key was obtained.
 //
-// See algorithm 3 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
-template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+// Returns number of iterations of the rejection sampling loop, it took to produce the signature, which is useful for
+// studying signing latency distribution.
+//
+// See algorithm 2 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr size_t
+sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+     const prepared_seckey_t<k, l>& prepared,
+     std::span<const uint8_t> msg,
+     std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+{
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { compute_mu(prepared.tr, msg, mu); });
+
+  return sign_mu<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, mu, sig, msg.size());
+}
+
+// Given a prepared ML-DSA secret key, SHAKE256 state after absorbing tr || prefix ( see `absorb_prefix` ) and rest of
+// the message, this routine computes a hedged/ deterministic signature over prefix || suffix, same as `sign` does for
+// the whole message, while absorbing only the suffix. Returns false, without signing, if the state was computed for
+// another key.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
 static inline constexpr bool
-verify(std::span<const uint8_t, ml_dsa_utils::pub_key_len(k, d)> pubkey, std::span<const uint8_t> msg, std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
-  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+     const prepared_seckey_t<k, l>& prepared,
+     const mu_prefix_t& state,
+     std::span<const uint8_t> suffix,
+     std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
 {
-  constexpr size_t t1_bw = std::bit_width(ml_dsa_field::Q) - d;
+  if (state.tr != prepared.tr) {
+    return false;
+  }
+
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { compute_mu(state, suffix, mu); });
+
+  sign_mu<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, mu, sig, state.prefix_len + suffix.size());
+  return true;
+}
+
+// Given a prepared ML-DSA secret key, context string ( of at most 255 -bytes, can be empty ) and message, this routine
+// computes a hedged/ deterministic signature, bound to the context string. Returns false, without signing, if context
+// string is too long.
+//
+// See algorithm 2 of ML-DSA standard @ https://doi.org/10.6028/NIST.FIPS.204.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+     const prepared_seckey_t<k, l>& prepared,
+     std::span<const uint8_t> ctx,
+     std::span<const uint8_t> msg,
+     std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+{
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  bool is_well_formed = false;
+
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { is_well_formed = compute_mu(prepared.tr, ctx, msg, mu); });
+  if (!is_well_formed) {
+    return false;
+  }
+
+  sign_mu<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, mu, sig, msg.size());
+  return true;
+}
+
+// Given a prepared ML-DSA secret key, context string, a pre-hash function and digest of the message, computed using that
+// function, this routine computes a hedged/ deterministic HashML-DSA signature, binding the digest, the pre-hash
+// function and the context string. Returns false, without signing, if context string or digest is malformed, see
+// `compute_mu_prehash`.
+//
+// See algorithm 4 of ML-DSA standard @ https://doi.org/10.6028/NIST.FIPS.204.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+sign_prehash(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+             const prepared_seckey_t<k, l>& prepared,
+             std::span<const uint8_t> ctx,
+             const ml_dsa_prehash::hash_t hash,
+             std::span<const uint8_t> digest,
+             std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+{
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  bool is_well_formed = false;
+
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { is_well_formed = compute_mu_prehash(prepared.tr, ctx, hash, digest, mu); });
+  if (!is_well_formed) {
+    return false;
+  }
+
+  sign_mu<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, mu, sig, digest.size());
+  return true;
+}
+
+// Given a ML-DSA secret key and message (can be empty too), this routine computes a hedged/ deterministic signature.
+//
+// Notice, first parameter of this function, `rnd`, which lets you pass 32 -bytes randomness for generating default
+// "hedged" signature. In case you don't need randomized message signature, you can instead fill `rnd` with zeros, and
+// it'll generate a deterministic signature.
+//
+// Note, hedged signing is the default and recommended version.
+//
+// See algorithm 2 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr void
+sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+     std::span<const uint8_t, ml_dsa_utils::sec_key_len(k, l, η, d)> seckey,
+     std::span<const uint8_t> msg,
+     std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+{
+  prepared_seckey_t<k, l> prepared{};
+
+  prepare_seckey<k, l, d, η>(seckey, prepared);
+  sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, msg, sig);
+}
+
+// Given a ML-DSA secret key, context string and message, this routine computes a hedged/ deterministic signature, bound
+// to the context string, see `sign` taking a prepared secret key and a context string.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+sign(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+     std::span<const uint8_t, ml_dsa_utils::sec_key_len(k, l, η, d)> seckey,
+     std::span<const uint8_t> ctx,
+     std::span<const uint8_t> msg,
+     std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+{
+  prepared_seckey_t<k, l> prepared{};
+
+  prepare_seckey<k, l, d, η>(seckey, prepared);
+  return sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, ctx, msg, sig);
+}
+
+// Given a ML-DSA secret key, context string, a pre-hash function and digest of the message, this routine computes a
+// hedged/ deterministic HashML-DSA signature, see `sign_prehash` taking a prepared secret key.
+template<size_t k, size_t l, size_t d, uint32_t η, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+sign_prehash(std::span<const uint8_t, RND_BYTE_LEN> rnd,
+             std::span<const uint8_t, ml_dsa_utils::sec_key_len(k, l, η, d)> seckey,
+             std::span<const uint8_t> ctx,
+             const ml_dsa_prehash::hash_t hash,
+             std::span<const uint8_t> digest,
+             std::span<uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_signing_params(k, l, d, η, γ1, γ2, τ, β, ω, λ))
+{
+  prepared_seckey_t<k, l> prepared{};
+
+  prepare_seckey<k, l, d, η>(seckey, prepared);
+  return sign_prehash<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, ctx, hash, digest, sig);
+}
+
+// Given a serialized ML-DSA signature, this routine decodes hint bits h, challenge polynomial c and response vector z,
+// taking c and z to NTT domain. Returns false, if the signature is malformed or z is too large, so that the signature
+// can't be valid.
+template<size_t k, size_t l, uint32_t γ1, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+decode_signature(std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig,
+                 std::span<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> h,
+                 std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> c,
+                 std::span<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> z)
+{
+  using stage_t = ml_dsa_instrument::stage_t;
+
   constexpr size_t gamma1_bw = std::bit_width(γ1);
 
   // Decode signature
@@ -305,96 +750,374 @@ verify(std::span<const uint8_t, ml_dsa_utils::pub_key_len(k, d)> pubkey, std::sp
   constexpr size_t sigoff2 = sigoff1 + (32 * l * gamma1_bw);
   constexpr size_t sigoff3 = sig.size();
 
-  auto c_tilda = sig.template first<sigoff1 - sigoff0>();
-  auto c1_tilda = c_tilda.template first<32>();
+  auto c1_tilda = sig.template first<32>();
   auto z_encoded = sig.template subspan<sigoff1, sigoff2 - sigoff1>();
   auto h_encoded = sig.template subspan<sigoff2, sigoff3 - sigoff2>();
 
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h{};
-  const bool has_failed = ml_dsa_bit_packing::decode_hint_bits<k, ω>(h_encoded, h);
+  bool has_failed = false;
+
+  ml_dsa_instrument::measure<stage_t::packing>([&]() { has_failed = ml_dsa_bit_packing::decode_hint_bits<k, ω>(h_encoded, h); });
   if (has_failed) {
     return false;
   }
 
-  const size_t count_1s = ml_dsa_polyvec::count_1s<k>(h);
+  size_t count_1s = 0;
+  ml_dsa_instrument::measure<stage_t::norm_check>([&]() { count_1s = ml_dsa_polyvec::count_1s<k>(h); });
   if (count_1s > ω) {
     return false;
   }
 
-  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> c{};
-  ml_dsa_sampling::sample_in_ball<τ>(c1_tilda, c);
-  ml_dsa_ntt::ntt(c);
+  ml_dsa_instrument::measure<stage_t::sample_in_ball>([&]() { ml_dsa_sampling::sample_in_ball<τ>(c1_tilda, c); });
+  ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_ntt::ntt(c); });
 
-  std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> z{};
-  ml_dsa_polyvec::decode<l, gamma1_bw>(z_encoded, z);
-  ml_dsa_polyvec::sub_from_x<l, γ1>(z);
+  ml_dsa_instrument::measure<stage_t::packing>([&]() { ml_dsa_polyvec::decode_centered<l, gamma1_bw, γ1>(z_encoded, z); });
 
-  const ml_dsa_field::zq_t z_norm = ml_dsa_polyvec::infinity_norm<l>(z);
+  ml_dsa_field::zq_t z_norm{};
+  ml_dsa_instrument::measure<stage_t::norm_check>([&]() { z_norm = ml_dsa_polyvec::infinity_norm<l>(z); });
   if (z_norm >= ml_dsa_field::zq_t(γ1 - β)) {
     return false;
   }
 
-  // Decode public key
-  constexpr size_t pkoff0 = 0;
-  constexpr size_t pkoff1 = pkoff0 + 32;
-  constexpr size_t pkoff2 = pubkey.size();
+  ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_polyvec::ntt<l>(z); });
+  return true;
+}
 
-  auto rho = pubkey.template subspan<pkoff0, pkoff1 - pkoff0>();
-  auto t1_encoded = pubkey.template subspan<pkoff1, pkoff2 - pkoff1>();
+// Given a prepared ML-DSA public key, message representative μ, commitment hash c_tilda, hint bits h and challenge
+// polynomial c of a signature, along with A·z ( in NTT domain, which is consumed ), this routine recovers high order
+// bits of the commitment w1, returning truth value, only if they hash to c_tilda.
+template<size_t k, size_t l, uint32_t γ2, size_t λ, bool packed>
+static inline constexpr bool
+check_commitment(const prepared_pubkey_t<k, l, packed>& prepared,
+                 std::span<const uint8_t, MU_BYTE_LEN> mu,
+                 std::span<const uint8_t, (2 * λ) / std::numeric_limits<uint8_t>::digits> c_tilda,
+                 std::span<const uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> h,
+                 std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> c,
+                 std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w0)
+{
+  using stage_t = ml_dsa_instrument::stage_t;
 
-  std::array<ml_dsa_field::zq_t, k * l * ml_dsa_ntt::N> A{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> t1{};
+  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w2{};
 
-  ml_dsa_sampling::expand_a<k, l>(rho, A);
-  ml_dsa_polyvec::decode<k, t1_bw>(t1_encoded, t1);
+  ml_dsa_instrument::measure<stage_t::matrix_multiply>([&]() { ml_dsa_polyvec::mul_by_poly<k>(c, prepared.t1, w2); });
+  ml_dsa_polyvec::sub_from<k>(w2, w0);
 
-  std::array<uint8_t, 64> tr{};
-  std::array<uint8_t, 64> mu{};
+  constexpr uint32_t α = γ2 << 1;
+  constexpr uint32_t m = (ml_dsa_field::Q - 1u) / α;
+  constexpr size_t w1bw = std::bit_width(m - 1u);
+  constexpr size_t w1_poly_blen = w1bw * 32;
 
   shake256::shake256_t hasher;
-  hasher.absorb(pubkey);
-  hasher.finalize();
-  hasher.squeeze(tr);
+  hasher.absorb(mu);
 
-  hasher.reset();
-  hasher.absorb(tr);
-  hasher.absorb(msg);
-  hasher.finalize();
-  hasher.squeeze(mu);
+  // Each row of w0 is taken from NTT domain to serialized high order bits of w0 + ct0 ( recovered using hint bits ),
+  // which are absorbed into the hasher right away.
+  for (size_t i = 0; i < k; i++) {
+    const size_t off0 = i * ml_dsa_ntt::N;
+    const size_t off1 = i * ml_dsa_bit_packing::HINT_WORDS_PER_POLY;
+
+    auto w0_row = std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N>(w0.data() + off0, ml_dsa_ntt::N);
+    auto h_row = std::span<const uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY>(h.data() + off1, ml_dsa_bit_packing::HINT_WORDS_PER_POLY);
+
+    std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> w1_row{};
+    std::array<uint8_t, w1_poly_blen> w1_row_encoded{};
+
+    ml_dsa_instrument::measure<stage_t::ntt>([&]() { ml_dsa_ntt::intt(w0_row); });
+    ml_dsa_instrument::measure<stage_t::hint>([&]() { ml_dsa_poly::use_hint<α>(h_row, w0_row, w1_row); });
+    ml_dsa_instrument::measure<stage_t::packing>([&]() { ml_dsa_bit_packing::encode<w1bw>(w1_row, w1_row_encoded); });
+    ml_dsa_instrument::measure<stage_t::hashing>([&]() { hasher.absorb(w1_row_encoded); });
+  }
+
+  std::array<uint8_t, c_tilda.size()> c_tilda_prime{};
+
+  ml_dsa_instrument::measure<stage_t::hashing>([&]() {
+    hasher.finalize();
+    hasher.squeeze(c_tilda_prime);
+  });
+
+  return std::equal(c_tilda.begin(), c_tilda.end(), c_tilda_prime.begin());
+}
+
+// Given a prepared ML-DSA public key, message representative μ ( see `compute_mu` ) and serialized signature, this
+// routine verifies the correctness of signature, same as `verify` does, when invoked with the message, μ was computed
+// from. Byte length of that message, if known, can be passed as `mlen`, which is only reported to tracing probes.
+//
+// See algorithm 3 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ, bool packed>
+static inline constexpr bool
+verify_mu(const prepared_pubkey_t<k, l, packed>& prepared,
+          std::span<const uint8_t, MU_BYTE_LEN> mu,
+          std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig,
+          [[maybe_unused]] const size_t mlen = 0)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  ml_dsa_instrument::record_call(ml_dsa_instrument::op_t::verify);
+  ML_DSA_PROBE(verify__entry, ml_dsa_probes::PARAM_SET<k, l>, mlen);
+
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> h{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> c{};
+  std::array<ml_dsa_field::zq_t, l * ml_dsa_ntt::N> z{};
+
+  if (!decode_signature<k, l, γ1, τ, β, ω, λ>(sig, h, c, z)) {
+    ML_DSA_PROBE(verify__return, ml_dsa_probes::PARAM_SET<k, l>, mlen, 0);
+    return false;
+  }
 
   std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w0{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w1{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> w2{};
 
-  ml_dsa_polyvec::ntt<l>(z);
-  ml_dsa_polyvec::matrix_multiply<k, l, l, 1>(A, z, w0);
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::matrix_multiply>([&]() {
+    if constexpr (packed) {
+      ml_dsa_polyvec::matrix_multiply_packed<k, l, ml_dsa_field::Q_BIT_WIDTH>(prepared.A, z, w0);
+    } else {
+      ml_dsa_polyvec::matrix_multiply<k, l, l, 1>(prepared.A, z, w0);
+    }
+  });
 
-  ml_dsa_polyvec::shl<k, d>(t1);
-  ml_dsa_polyvec::ntt<k>(t1);
-  ml_dsa_polyvec::mul_by_poly<k>(c, t1, w2);
-  ml_dsa_polyvec::neg<k>(w2);
+  constexpr size_t c_tilda_len = (2 * λ) / std::numeric_limits<uint8_t>::digits;
+  const bool is_valid = check_commitment<k, l, γ2, λ>(prepared, mu, sig.template first<c_tilda_len>(), h, c, w0);
 
-  ml_dsa_polyvec::add_to<k>(w0, w2);
-  ml_dsa_polyvec::intt<k>(w2);
+  ML_DSA_PROBE(verify__return, ml_dsa_probes::PARAM_SET<k, l>, mlen, static_cast<uint32_t>(is_valid));
+  return is_valid;
+}
 
-  constexpr uint32_t α = γ2 << 1;
-  constexpr uint32_t m = (ml_dsa_field::Q - 1u) / α;
-  constexpr size_t w1bw = std::bit_width(m - 1u);
+// Number of signatures, whose response vectors are multiplied by matrix A together, by `verify_many`.
+static constexpr size_t VERIFY_MANY_BATCH_SIZE = 4;
 
-  ml_dsa_polyvec::use_hint<k, α>(h, w2, w1);
+// Given a prepared ML-DSA public key, n messages and n serialized signatures, this routine verifies i-th signature over
+// i-th message, writing the result to `status[i]`, same as `verify` does, returning truth value, only if all of them
+// are valid. Response vectors z of VERIFY_MANY_BATCH_SIZE consecutive signatures are multiplied by matrix A together,
+// so that each polynomial of A is loaded ( and unpacked, for packed prepared keys ) once per batch, rather than once
+// per signature. Signatures, which don't fill a whole batch, are verified one by one. Number of messages, signatures
+// and length of `status` must be equal.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ, bool packed>
+static inline constexpr bool
+verify_many(const prepared_pubkey_t<k, l, packed>& prepared,
+            std::span<const std::span<const uint8_t>> msgs,
+            std::span<const std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)>> sigs,
+            std::span<bool> status)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  constexpr size_t B = VERIFY_MANY_BATCH_SIZE;
+  constexpr size_t HW = ml_dsa_bit_packing::HINT_WORDS_PER_POLY;
+  constexpr size_t N = ml_dsa_ntt::N;
+  constexpr size_t c_tilda_len = (2 * λ) / std::numeric_limits<uint8_t>::digits;
 
-  std::array<uint8_t, k * w1bw * 32> w1_encoded{};
-  ml_dsa_polyvec::encode<k, w1bw>(w1, w1_encoded);
+  const size_t batched_cnt = sigs.size() - sigs.size() % B;
+  bool are_all_valid = true;
 
-  std::array<uint8_t, c_tilda.size()> c_tilda_prime{};
+  for (size_t off = 0; off < batched_cnt; off += B) {
+    std::array<std::array<uint8_t, MU_BYTE_LEN>, B> mu{};
+    std::array<std::array<uint64_t, k * HW>, B> h{};
+    std::array<std::array<ml_dsa_field::zq_t, N>, B> c{};
+    std::array<bool, B> is_decoded{};
 
-  hasher.reset();
-  hasher.absorb(mu);
-  hasher.absorb(w1_encoded);
-  hasher.finalize();
-  hasher.squeeze(c_tilda_prime);
+    // Response vectors of the batch, as columns of a l x B matrix
+    std::array<ml_dsa_field::zq_t, l * B * N> z{};
 
-  return std::equal(c_tilda.begin(), c_tilda.end(), c_tilda_prime.begin());
+    for (size_t b = 0; b < B; b++) {
+      ml_dsa_instrument::record_call(ml_dsa_instrument::op_t::verify);
+      ML_DSA_PROBE(verify__entry, ml_dsa_probes::PARAM_SET<k, l>, msgs[off + b].size());
+
+      ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { compute_mu(prepared.tr, msgs[off + b], mu[b]); });
+
+      std::array<ml_dsa_field::zq_t, l * N> z_col{};
+      is_decoded[b] = decode_signature<k, l, γ1, τ, β, ω, λ>(sigs[off + b], h[b], c[b], z_col);
+
+      for (size_t j = 0; is_decoded[b] && (j < l); j++) {
+        std::copy_n(z_col.begin() + j * N, N, z.begin() + (j * B + b) * N);
+      }
+    }
+
+    // Products of matrix A and each response vector, as columns of a k x B matrix
+    std::array<ml_dsa_field::zq_t, k * B * N> w{};
+
+    ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::matrix_multiply>([&]() {
+      if constexpr (packed) {
+        ml_dsa_polyvec::matrix_multiply_packed<k, l, ml_dsa_field::Q_BIT_WIDTH, B>(prepared.A, z, w);
+      } else {
+        ml_dsa_polyvec::matrix_multiply<k, l, l, B>(prepared.A, z, w);
+      }
+    });
+
+    for (size_t b = 0; b < B; b++) {
+      bool is_valid = false;
+
+      if (is_decoded[b]) {
+        std::array<ml_dsa_field::zq_t, k * N> w0{};
+        for (size_t i = 0; i < k; i++) {
+          std::copy_n(w.begin() + (i * B + b) * N, N, w0.begin() + i * N);
+        }
+
+        is_valid = check_commitment<k, l, γ2, λ>(prepared, mu[b], sigs[off + b].template first<c_tilda_len>(), h[b], c[b], w0);
+      }
+
+      ML_DSA_PROBE(verify__return, ml_dsa_probes::PARAM_SET<k, l>, msgs[off + b].size(), static_cast<uint32_t>(is_valid));
+
+      status[off + b] = is_valid;
+      are_all_valid &= is_valid;
+    }
+  }
+
+  for (size_t i = batched_cnt; i < sigs.size(); i++) {
+    std::array<uint8_t, MU_BYTE_LEN> mu{};
+    ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { compute_mu(prepared.tr, msgs[i], mu); });
+
+    status[i] = verify_mu<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, mu, sigs[i], msgs[i].size());
+    are_all_valid &= status[i];
+  }
+
+  return are_all_valid;
+}
+
+// Given a prepared ML-DSA public key, message (can be empty too) and serialized signature, this routine verifies the
+// correctness of signature, same as `verify` does, when invoked with the public key, from which prepared key was
+// obtained.
+//
+// See algorithm 3 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ, bool packed>
+static inline constexpr bool
+verify(const prepared_pubkey_t<k, l, packed>& prepared, std::span<const uint8_t> msg, std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { compute_mu(prepared.tr, msg, mu); });
+
+  return verify_mu<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, mu, sig, msg.size());
+}
+
+// Given a prepared ML-DSA public key, SHAKE256 state after absorbing tr || prefix ( see `absorb_prefix` ), rest of the
+// message and serialized signature, this routine verifies the signature over prefix || suffix, same as `verify` does
+// for the whole message, while absorbing only the suffix. Returns false, if the state was computed for another key.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ, bool packed>
+static inline constexpr bool
+verify(const prepared_pubkey_t<k, l, packed>& prepared,
+       const mu_prefix_t& state,
+       std::span<const uint8_t> suffix,
+       std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  if (state.tr != prepared.tr) {
+    return false;
+  }
+
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { compute_mu(state, suffix, mu); });
+
+  return verify_mu<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, mu, sig, state.prefix_len + suffix.size());
+}
+
+// Given a prepared ML-DSA public key, context string ( of at most 255 -bytes, can be empty ), message and serialized
+// signature, this routine verifies the signature, bound to the context string. Returns false, if context string is too
+// long.
+//
+// See algorithm 3 of ML-DSA standard @ https://doi.org/10.6028/NIST.FIPS.204.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ, bool packed>
+static inline constexpr bool
+verify(const prepared_pubkey_t<k, l, packed>& prepared,
+       std::span<const uint8_t> ctx,
+       std::span<const uint8_t> msg,
+       std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  bool is_well_formed = false;
+
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { is_well_formed = compute_mu(prepared.tr, ctx, msg, mu); });
+  if (!is_well_formed) {
+    return false;
+  }
+
+  return verify_mu<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, mu, sig, msg.size());
+}
+
+// Given a prepared ML-DSA public key, context string, a pre-hash function, digest of the message, computed using that
+// function, and serialized HashML-DSA signature, this routine verifies the signature. Returns false, if context string
+// or digest is malformed, see `compute_mu_prehash`.
+//
+// See algorithm 5 of ML-DSA standard @ https://doi.org/10.6028/NIST.FIPS.204.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ, bool packed>
+static inline constexpr bool
+verify_prehash(const prepared_pubkey_t<k, l, packed>& prepared,
+               std::span<const uint8_t> ctx,
+               const ml_dsa_prehash::hash_t hash,
+               std::span<const uint8_t> digest,
+               std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  std::array<uint8_t, MU_BYTE_LEN> mu{};
+  bool is_well_formed = false;
+
+  ml_dsa_instrument::measure<ml_dsa_instrument::stage_t::hashing>([&]() { is_well_formed = compute_mu_prehash(prepared.tr, ctx, hash, digest, mu); });
+  if (!is_well_formed) {
+    return false;
+  }
+
+  return verify_mu<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, mu, sig, digest.size());
+}
+
+// Given a ML-DSA public key, message (can be empty too) and serialized signature, this routine verifies the correctness
+// of signature, returning boolean result, denoting status of signature verification. For example, say it returns true,
+// it means signature is valid for given message and public key.
+//
+// See algorithm 3 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+verify(std::span<const uint8_t, ml_dsa_utils::pub_key_len(k, d)> pubkey, std::span<const uint8_t> msg, std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  prepared_pubkey_t<k, l> prepared{};
+
+  prepare_pubkey<k, l, d>(pubkey, prepared);
+  return verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, msg, sig);
+}
+
+// Given a ML-DSA public key, context string, message and serialized signature, this routine verifies the signature,
+// bound to the context string, see `verify` taking a prepared public key and a context string.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+verify(std::span<const uint8_t, ml_dsa_utils::pub_key_len(k, d)> pubkey,
+       std::span<const uint8_t> ctx,
+       std::span<const uint8_t> msg,
+       std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  prepared_pubkey_t<k, l> prepared{};
+
+  prepare_pubkey<k, l, d>(pubkey, prepared);
+  return verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, ctx, msg, sig);
+}
+
+// Given a ML-DSA public key, context string, a pre-hash function, digest of the message and serialized HashML-DSA
+// signature, this routine verifies the signature, see `verify_prehash` taking a prepared public key.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+verify_prehash(std::span<const uint8_t, ml_dsa_utils::pub_key_len(k, d)> pubkey,
+               std::span<const uint8_t> ctx,
+               const ml_dsa_prehash::hash_t hash,
+               std::span<const uint8_t> digest,
+               std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)> sig)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  prepared_pubkey_t<k, l> prepared{};
+
+  prepare_pubkey<k, l, d>(pubkey, prepared);
+  return verify_prehash<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, ctx, hash, digest, sig);
+}
+
+// Given a ML-DSA public key, n messages and n serialized signatures, this routine expands the public key once and
+// verifies i-th signature over i-th message, writing the result to `status[i]`, see `verify_many` taking a prepared
+// public key. Returns truth value, only if all signatures are valid.
+template<size_t k, size_t l, size_t d, uint32_t γ1, uint32_t γ2, uint32_t τ, uint32_t β, size_t ω, size_t λ>
+static inline constexpr bool
+verify_many(std::span<const uint8_t, ml_dsa_utils::pub_key_len(k, d)> pubkey,
+            std::span<const std::span<const uint8_t>> msgs,
+            std::span<const std::span<const uint8_t, ml_dsa_utils::sig_len(k, l, γ1, ω, λ)>> sigs,
+            std::span<bool> status)
+  requires(ml_dsa_params::check_verify_params(k, l, d, γ1, γ2, τ, β, ω, λ))
+{
+  prepared_pubkey_t<k, l> prepared{};
+
+  prepare_pubkey<k, l, d>(pubkey, prepared);
+  return verify_many<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, msgs, sigs, status);
 }
 
 }
@@ -1,26 +1,35 @@
 #pragma once
 #include "ml_dsa/internals/math/field.hpp"
+#include "bit_packing_avx.hpp"
 #include "ml_dsa/internals/utility/params.hpp"
 #include "ntt.hpp"
 #include <algorithm>
 #include <limits>
+#include <type_traits>
 
 // Bit packing/ unpacking -related utility functions
 namespace ml_dsa_bit_packing {
 
-// Given a degree-255 polynomial, where significant portion of each coefficient ∈ [0, 2^sbw), this
-// routine serializes the polynomial to a byte array of length 32 * sbw -bytes.
+// Hint bits of a degree-255 polynomial are kept as a 256 -bit bitset, packed into four 64 -bit words s.t. hint bit for
+// j -th coefficient lives at bit position (j % 64) of word (j / 64).
+static constexpr size_t HINT_WORDS_PER_POLY = ml_dsa_ntt::N / std::numeric_limits<uint64_t>::digits;
+
+// Given 256 coefficients of a degree-255 polynomial, each of them read using `coeff(i)` and having significant portion
+// ∈ [0, 2^sbw), this routine serializes them to a byte array of length 32 * sbw -bytes.
+//
+// Coefficients are read through `coeff`, so that a mapping ( say from [-x, x] to [0, 2x] ) can be applied on the fly,
+// while packing, instead of requiring a separate pass over the polynomial.
 //
 // See algorithm 10 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
-template<size_t sbw>
+template<size_t sbw, typename coeff_fn_t>
 static inline constexpr void
-encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_t, (ml_dsa_ntt::N * sbw) / std::numeric_limits<uint8_t>::digits> arr)
+pack(const coeff_fn_t coeff, std::span<uint8_t, (ml_dsa_ntt::N * sbw) / std::numeric_limits<uint8_t>::digits> arr)
   requires(ml_dsa_params::check_sbw(sbw))
 {
   std::fill(arr.begin(), arr.end(), 0);
 
   if constexpr (sbw == 3) {
-    constexpr size_t itr_cnt = poly.size() >> 3;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 3;
     constexpr uint32_t mask3 = 0b111u;
     constexpr uint32_t mask2 = mask3 >> 1;
     constexpr uint32_t mask1 = mask2 >> 1;
@@ -29,25 +38,25 @@ encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_
       const size_t poff = i << 3;
       const size_t boff = i * 3;
 
-      arr[boff + 0] = (static_cast<uint8_t>(poly[poff + 2].raw() & mask2) << 6) | (static_cast<uint8_t>(poly[poff + 1].raw() & mask3) << 3) |
-                      (static_cast<uint8_t>(poly[poff + 0].raw() & mask3) << 0);
-      arr[boff + 1] = (static_cast<uint8_t>(poly[poff + 5].raw() & mask1) << 7) | (static_cast<uint8_t>(poly[poff + 4].raw() & mask3) << 4) |
-                      (static_cast<uint8_t>(poly[poff + 3].raw() & mask3) << 1) | static_cast<uint8_t>((poly[poff + 2].raw() >> 2) & mask1);
-      arr[boff + 2] = (static_cast<uint8_t>(poly[poff + 7].raw() & mask3) << 5) | (static_cast<uint8_t>(poly[poff + 6].raw() & mask3) << 2) |
-                      static_cast<uint8_t>((poly[poff + 5].raw() >> 1) & mask2);
+      arr[boff + 0] = (static_cast<uint8_t>(coeff(poff + 2) & mask2) << 6) | (static_cast<uint8_t>(coeff(poff + 1) & mask3) << 3) |
+                      (static_cast<uint8_t>(coeff(poff + 0) & mask3) << 0);
+      arr[boff + 1] = (static_cast<uint8_t>(coeff(poff + 5) & mask1) << 7) | (static_cast<uint8_t>(coeff(poff + 4) & mask3) << 4) |
+                      (static_cast<uint8_t>(coeff(poff + 3) & mask3) << 1) | static_cast<uint8_t>((coeff(poff + 2) >> 2) & mask1);
+      arr[boff + 2] = (static_cast<uint8_t>(coeff(poff + 7) & mask3) << 5) | (static_cast<uint8_t>(coeff(poff + 6) & mask3) << 2) |
+                      static_cast<uint8_t>((coeff(poff + 5) >> 1) & mask2);
     }
   } else if constexpr (sbw == 4) {
-    constexpr size_t itr_cnt = poly.size() >> 1;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 1;
     constexpr uint32_t mask = 0b1111u;
 
     for (size_t i = 0; i < itr_cnt; i++) {
       const size_t off = i << 1;
-      const uint8_t byte = (static_cast<uint8_t>(poly[off + 1].raw() & mask) << 4) | (static_cast<uint8_t>(poly[off + 0].raw() & mask) << 0);
+      const uint8_t byte = (static_cast<uint8_t>(coeff(off + 1) & mask) << 4) | (static_cast<uint8_t>(coeff(off + 0) & mask) << 0);
 
       arr[i] = byte;
     }
   } else if constexpr (sbw == 6) {
-    constexpr size_t itr_cnt = poly.size() >> 2;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 2;
     constexpr uint32_t mask6 = 0b111111u;
     constexpr uint32_t mask4 = mask6 >> 2;
     constexpr uint32_t mask2 = mask4 >> 2;
@@ -56,12 +65,12 @@ encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_
       const size_t poff = i << 2;
       const size_t boff = i * 3;
 
-      arr[boff + 0] = (static_cast<uint8_t>(poly[poff + 1].raw() & mask2) << 6) | (static_cast<uint8_t>(poly[poff + 0].raw() & mask6) << 0);
-      arr[boff + 1] = (static_cast<uint8_t>(poly[poff + 2].raw() & mask4) << 4) | static_cast<uint8_t>((poly[poff + 1].raw() >> 2) & mask4);
-      arr[boff + 2] = (static_cast<uint8_t>(poly[poff + 3].raw() & mask6) << 2) | static_cast<uint8_t>((poly[poff + 2].raw() >> 4) & mask2);
+      arr[boff + 0] = (static_cast<uint8_t>(coeff(poff + 1) & mask2) << 6) | (static_cast<uint8_t>(coeff(poff + 0) & mask6) << 0);
+      arr[boff + 1] = (static_cast<uint8_t>(coeff(poff + 2) & mask4) << 4) | static_cast<uint8_t>((coeff(poff + 1) >> 2) & mask4);
+      arr[boff + 2] = (static_cast<uint8_t>(coeff(poff + 3) & mask6) << 2) | static_cast<uint8_t>((coeff(poff + 2) >> 4) & mask2);
     }
   } else if constexpr (sbw == 10) {
-    constexpr size_t itr_cnt = poly.size() >> 2;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 2;
     constexpr uint32_t mask6 = 0b111111u;
     constexpr uint32_t mask4 = mask6 >> 2;
     constexpr uint32_t mask2 = mask4 >> 2;
@@ -70,14 +79,14 @@ encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_
       const size_t poff = i << 2;
       const size_t boff = i * 5;
 
-      arr[boff + 0] = static_cast<uint8_t>(poly[poff + 0].raw());
-      arr[boff + 1] = static_cast<uint8_t>((poly[poff + 1].raw() & mask6) << 2) | static_cast<uint8_t>((poly[poff + 0].raw() >> 8) & mask2);
-      arr[boff + 2] = static_cast<uint8_t>((poly[poff + 2].raw() & mask4) << 4) | static_cast<uint8_t>((poly[poff + 1].raw() >> 6) & mask4);
-      arr[boff + 3] = static_cast<uint8_t>((poly[poff + 3].raw() & mask2) << 6) | static_cast<uint8_t>((poly[poff + 2].raw() >> 4) & mask6);
-      arr[boff + 4] = static_cast<uint8_t>(poly[poff + 3].raw() >> 2);
+      arr[boff + 0] = static_cast<uint8_t>(coeff(poff + 0));
+      arr[boff + 1] = static_cast<uint8_t>((coeff(poff + 1) & mask6) << 2) | static_cast<uint8_t>((coeff(poff + 0) >> 8) & mask2);
+      arr[boff + 2] = static_cast<uint8_t>((coeff(poff + 2) & mask4) << 4) | static_cast<uint8_t>((coeff(poff + 1) >> 6) & mask4);
+      arr[boff + 3] = static_cast<uint8_t>((coeff(poff + 3) & mask2) << 6) | static_cast<uint8_t>((coeff(poff + 2) >> 4) & mask6);
+      arr[boff + 4] = static_cast<uint8_t>(coeff(poff + 3) >> 2);
     }
   } else if constexpr (sbw == 13) {
-    constexpr size_t itr_cnt = poly.size() >> 3;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 3;
     constexpr uint32_t mask7 = 0b1111111u;
     constexpr uint32_t mask6 = mask7 >> 1;
     constexpr uint32_t mask5 = mask6 >> 1;
@@ -90,22 +99,22 @@ encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_
       const size_t poff = i << 3;
       const size_t boff = i * 13;
 
-      arr[boff + 0] = static_cast<uint8_t>(poly[poff + 0].raw());
-      arr[boff + 1] = static_cast<uint8_t>((poly[poff + 1].raw() & mask3) << 5) | static_cast<uint8_t>((poly[poff + 0].raw() >> 8) & mask5);
-      arr[boff + 2] = static_cast<uint8_t>(poly[poff + 1].raw() >> 3);
-      arr[boff + 3] = static_cast<uint8_t>((poly[poff + 2].raw() & mask6) << 2) | static_cast<uint8_t>((poly[poff + 1].raw() >> 11) & mask2);
-      arr[boff + 4] = static_cast<uint8_t>((poly[poff + 3].raw() & mask1) << 7) | static_cast<uint8_t>((poly[poff + 2].raw() >> 6) & mask7);
-      arr[boff + 5] = static_cast<uint8_t>(poly[poff + 3].raw() >> 1);
-      arr[boff + 6] = static_cast<uint8_t>((poly[poff + 4].raw() & mask4) << 4) | static_cast<uint8_t>((poly[poff + 3].raw() >> 9) & mask4);
-      arr[boff + 7] = static_cast<uint8_t>(poly[poff + 4].raw() >> 4);
-      arr[boff + 8] = static_cast<uint8_t>((poly[poff + 5].raw() & mask7) << 1) | static_cast<uint8_t>((poly[poff + 4].raw() >> 12) & mask1);
-      arr[boff + 9] = static_cast<uint8_t>((poly[poff + 6].raw() & mask2) << 6) | static_cast<uint8_t>((poly[poff + 5].raw() >> 7) & mask6);
-      arr[boff + 10] = static_cast<uint8_t>(poly[poff + 6].raw() >> 2);
-      arr[boff + 11] = static_cast<uint8_t>((poly[poff + 7].raw() & mask5) << 3) | static_cast<uint8_t>((poly[poff + 6].raw() >> 10) & mask3);
-      arr[boff + 12] = static_cast<uint8_t>(poly[poff + 7].raw() >> 5);
+      arr[boff + 0] = static_cast<uint8_t>(coeff(poff + 0));
+      arr[boff + 1] = static_cast<uint8_t>((coeff(poff + 1) & mask3) << 5) | static_cast<uint8_t>((coeff(poff + 0) >> 8) & mask5);
+      arr[boff + 2] = static_cast<uint8_t>(coeff(poff + 1) >> 3);
+      arr[boff + 3] = static_cast<uint8_t>((coeff(poff + 2) & mask6) << 2) | static_cast<uint8_t>((coeff(poff + 1) >> 11) & mask2);
+      arr[boff + 4] = static_cast<uint8_t>((coeff(poff + 3) & mask1) << 7) | static_cast<uint8_t>((coeff(poff + 2) >> 6) & mask7);
+      arr[boff + 5] = static_cast<uint8_t>(coeff(poff + 3) >> 1);
+      arr[boff + 6] = static_cast<uint8_t>((coeff(poff + 4) & mask4) << 4) | static_cast<uint8_t>((coeff(poff + 3) >> 9) & mask4);
+      arr[boff + 7] = static_cast<uint8_t>(coeff(poff + 4) >> 4);
+      arr[boff + 8] = static_cast<uint8_t>((coeff(poff + 5) & mask7) << 1) | static_cast<uint8_t>((coeff(poff + 4) >> 12) & mask1);
+      arr[boff + 9] = static_cast<uint8_t>((coeff(poff + 6) & mask2) << 6) | static_cast<uint8_t>((coeff(poff + 5) >> 7) & mask6);
+      arr[boff + 10] = static_cast<uint8_t>(coeff(poff + 6) >> 2);
+      arr[boff + 11] = static_cast<uint8_t>((coeff(poff + 7) & mask5) << 3) | static_cast<uint8_t>((coeff(poff + 6) >> 10) & mask3);
+      arr[boff + 12] = static_cast<uint8_t>(coeff(poff + 7) >> 5);
     }
   } else if constexpr (sbw == 18) {
-    constexpr size_t itr_cnt = poly.size() >> 2;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 2;
     constexpr uint32_t mask6 = 0b111111u;
     constexpr uint32_t mask4 = mask6 >> 2;
     constexpr uint32_t mask2 = mask4 >> 2;
@@ -114,29 +123,29 @@ encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_
       const size_t poff = i << 2;
       const size_t boff = i * 9;
 
-      arr[boff + 0] = static_cast<uint8_t>(poly[poff + 0].raw());
-      arr[boff + 1] = static_cast<uint8_t>(poly[poff + 0].raw() >> 8);
-      arr[boff + 2] = static_cast<uint8_t>((poly[poff + 1].raw() & mask6) << 2) | static_cast<uint8_t>((poly[poff + 0].raw() >> 16) & mask2);
-      arr[boff + 3] = static_cast<uint8_t>(poly[poff + 1].raw() >> 6);
-      arr[boff + 4] = static_cast<uint8_t>((poly[poff + 2].raw() & mask4) << 4) | static_cast<uint8_t>((poly[poff + 1].raw() >> 14) & mask4);
-      arr[boff + 5] = static_cast<uint8_t>(poly[poff + 2].raw() >> 4);
-      arr[boff + 6] = static_cast<uint8_t>((poly[poff + 3].raw() & mask2) << 6) | static_cast<uint8_t>((poly[poff + 2].raw() >> 12) & mask6);
-      arr[boff + 7] = static_cast<uint8_t>(poly[poff + 3].raw() >> 2);
-      arr[boff + 8] = static_cast<uint8_t>(poly[poff + 3].raw() >> 10);
+      arr[boff + 0] = static_cast<uint8_t>(coeff(poff + 0));
+      arr[boff + 1] = static_cast<uint8_t>(coeff(poff + 0) >> 8);
+      arr[boff + 2] = static_cast<uint8_t>((coeff(poff + 1) & mask6) << 2) | static_cast<uint8_t>((coeff(poff + 0) >> 16) & mask2);
+      arr[boff + 3] = static_cast<uint8_t>(coeff(poff + 1) >> 6);
+      arr[boff + 4] = static_cast<uint8_t>((coeff(poff + 2) & mask4) << 4) | static_cast<uint8_t>((coeff(poff + 1) >> 14) & mask4);
+      arr[boff + 5] = static_cast<uint8_t>(coeff(poff + 2) >> 4);
+      arr[boff + 6] = static_cast<uint8_t>((coeff(poff + 3) & mask2) << 6) | static_cast<uint8_t>((coeff(poff + 2) >> 12) & mask6);
+      arr[boff + 7] = static_cast<uint8_t>(coeff(poff + 3) >> 2);
+      arr[boff + 8] = static_cast<uint8_t>(coeff(poff + 3) >> 10);
     }
   } else if constexpr (sbw == 20) {
-    constexpr size_t itr_cnt = poly.size() >> 1;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 1;
     constexpr uint32_t mask4 = 0b1111u;
 
     for (size_t i = 0; i < itr_cnt; i++) {
       const size_t poff = i << 1;
       const size_t boff = i * 5;
 
-      arr[boff + 0] = static_cast<uint8_t>(poly[poff + 0].raw());
-      arr[boff + 1] = static_cast<uint8_t>(poly[poff + 0].raw() >> 8);
-      arr[boff + 2] = static_cast<uint8_t>((poly[poff + 1].raw() & mask4) << 4) | static_cast<uint8_t>((poly[poff + 0].raw() >> 16) & mask4);
-      arr[boff + 3] = static_cast<uint8_t>(poly[poff + 1].raw() >> 4);
-      arr[boff + 4] = static_cast<uint8_t>(poly[poff + 1].raw() >> 12);
+      arr[boff + 0] = static_cast<uint8_t>(coeff(poff + 0));
+      arr[boff + 1] = static_cast<uint8_t>(coeff(poff + 0) >> 8);
+      arr[boff + 2] = static_cast<uint8_t>((coeff(poff + 1) & mask4) << 4) | static_cast<uint8_t>((coeff(poff + 0) >> 16) & mask4);
+      arr[boff + 3] = static_cast<uint8_t>(coeff(poff + 1) >> 4);
+      arr[boff + 4] = static_cast<uint8_t>(coeff(poff + 1) >> 12);
     }
   } else {
     for (size_t i = 0; i < arr.size() * 8; i++) {
@@ -146,26 +155,27 @@ encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_
       const size_t aidx = i >> 3;
       const size_t aoff = i & 7ul;
 
-      const uint8_t bit = static_cast<uint8_t>((poly[pidx].raw() >> poff) & 0b1);
+      const uint8_t bit = static_cast<uint8_t>((coeff(pidx) >> poff) & 0b1);
       arr[aidx] = arr[aidx] ^ (bit << aoff);
     }
   }
 }
 
-// Given a byte array of length 32 * sbw -bytes, this routine extracts out 256 coefficients of a degree-255
-// polynomial s.t. significant portion of each coefficient ∈ [0, 2^sbw).
+// Given a byte array of length 32 * sbw -bytes, this routine extracts out 256 coefficients of a degree-255 polynomial
+// s.t. significant portion of each coefficient ∈ [0, 2^sbw), handing each of them over to `store(i, coeff)`.
 //
-// This is just the opposite of above `encode` routine.
+// Coefficients are written through `store`, so that a mapping ( say from [0, 2x] to [-x, x] ) can be applied on the
+// fly, while unpacking, instead of requiring a separate pass over the polynomial.
+//
+// This is just the opposite of above `pack` routine.
 // See algorithm 12 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
-template<size_t sbw>
+template<size_t sbw, typename store_fn_t>
 static inline constexpr void
-decode(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly)
+unpack(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, const store_fn_t store)
   requires(ml_dsa_params::check_sbw(sbw))
 {
-  std::fill(poly.begin(), poly.end(), ml_dsa_field::zq_t::zero());
-
   if constexpr (sbw == 3) {
-    constexpr size_t itr_cnt = poly.size() >> 3;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 3;
     constexpr uint8_t mask3 = 0b111;
     constexpr uint8_t mask2 = mask3 >> 1;
     constexpr uint8_t mask1 = mask2 >> 1;
@@ -174,28 +184,28 @@ decode(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_f
       const size_t poff = i << 3;
       const size_t boff = i * 3;
 
-      poly[poff + 0] = static_cast<uint32_t>((arr[boff + 0] >> 0) & mask3);
-      poly[poff + 1] = static_cast<uint32_t>((arr[boff + 0] >> 3) & mask3);
-      poly[poff + 2] = static_cast<uint32_t>((arr[boff + 1] & mask1) << 2) | static_cast<uint32_t>(arr[boff + 0] >> 6);
-      poly[poff + 3] = static_cast<uint32_t>((arr[boff + 1] >> 1) & mask3);
-      poly[poff + 4] = static_cast<uint32_t>((arr[boff + 1] >> 4) & mask3);
-      poly[poff + 5] = static_cast<uint32_t>((arr[boff + 2] & mask2) << 1) | static_cast<uint32_t>(arr[boff + 1] >> 7);
-      poly[poff + 6] = static_cast<uint32_t>((arr[boff + 2] >> 2) & mask3);
-      poly[poff + 7] = static_cast<uint32_t>(arr[boff + 2] >> 5);
+      store(poff + 0, static_cast<uint32_t>((arr[boff + 0] >> 0) & mask3));
+      store(poff + 1, static_cast<uint32_t>((arr[boff + 0] >> 3) & mask3));
+      store(poff + 2, static_cast<uint32_t>((arr[boff + 1] & mask1) << 2) | static_cast<uint32_t>(arr[boff + 0] >> 6));
+      store(poff + 3, static_cast<uint32_t>((arr[boff + 1] >> 1) & mask3));
+      store(poff + 4, static_cast<uint32_t>((arr[boff + 1] >> 4) & mask3));
+      store(poff + 5, static_cast<uint32_t>((arr[boff + 2] & mask2) << 1) | static_cast<uint32_t>(arr[boff + 1] >> 7));
+      store(poff + 6, static_cast<uint32_t>((arr[boff + 2] >> 2) & mask3));
+      store(poff + 7, static_cast<uint32_t>(arr[boff + 2] >> 5));
     }
   } else if constexpr (sbw == 4) {
-    constexpr size_t itr_cnt = poly.size() >> 1;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 1;
     constexpr uint8_t mask = 0b1111;
 
     for (size_t i = 0; i < itr_cnt; i++) {
       const size_t off = i << 1;
       const uint8_t byte = arr[i];
 
-      poly[off + 0] = static_cast<uint32_t>((byte >> 0) & mask);
-      poly[off + 1] = static_cast<uint32_t>((byte >> 4) & mask);
+      store(off + 0, static_cast<uint32_t>((byte >> 0) & mask));
+      store(off + 1, static_cast<uint32_t>((byte >> 4) & mask));
     }
   } else if constexpr (sbw == 6) {
-    constexpr size_t itr_cnt = poly.size() >> 2;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 2;
     constexpr uint8_t mask6 = 0b111111;
     constexpr uint8_t mask4 = mask6 >> 2;
     constexpr uint8_t mask2 = mask4 >> 2;
@@ -204,13 +214,13 @@ decode(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_f
       const size_t poff = i << 2;
       const size_t boff = i * 3;
 
-      poly[poff + 0] = static_cast<uint32_t>(arr[boff + 0] & mask6);
-      poly[poff + 1] = static_cast<uint32_t>((arr[boff + 1] & mask4) << 2) | static_cast<uint32_t>(arr[boff + 0] >> 6);
-      poly[poff + 2] = static_cast<uint32_t>((arr[boff + 2] & mask2) << 4) | static_cast<uint32_t>(arr[boff + 1] >> 4);
-      poly[poff + 3] = static_cast<uint32_t>(arr[boff + 2] >> 2);
+      store(poff + 0, static_cast<uint32_t>(arr[boff + 0] & mask6));
+      store(poff + 1, static_cast<uint32_t>((arr[boff + 1] & mask4) << 2) | static_cast<uint32_t>(arr[boff + 0] >> 6));
+      store(poff + 2, static_cast<uint32_t>((arr[boff + 2] & mask2) << 4) | static_cast<uint32_t>(arr[boff + 1] >> 4));
+      store(poff + 3, static_cast<uint32_t>(arr[boff + 2] >> 2));
     }
   } else if constexpr (sbw == 10) {
-    constexpr size_t itr_cnt = poly.size() >> 2;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 2;
     constexpr uint8_t mask6 = 0b111111;
     constexpr uint8_t mask4 = mask6 >> 2;
     constexpr uint8_t mask2 = mask4 >> 2;
@@ -219,13 +229,13 @@ decode(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_f
       const size_t poff = i << 2;
       const size_t boff = i * 5;
 
-      poly[poff + 0] = (static_cast<uint16_t>(arr[boff + 1] & mask2) << 8) | static_cast<uint16_t>(arr[boff + 0]);
-      poly[poff + 1] = (static_cast<uint16_t>(arr[boff + 2] & mask4) << 6) | static_cast<uint16_t>(arr[boff + 1] >> 2);
-      poly[poff + 2] = (static_cast<uint16_t>(arr[boff + 3] & mask6) << 4) | static_cast<uint16_t>(arr[boff + 2] >> 4);
-      poly[poff + 3] = (static_cast<uint16_t>(arr[boff + 4]) << 2) | static_cast<uint16_t>(arr[boff + 3] >> 6);
+      store(poff + 0, (static_cast<uint16_t>(arr[boff + 1] & mask2) << 8) | static_cast<uint16_t>(arr[boff + 0]));
+      store(poff + 1, (static_cast<uint16_t>(arr[boff + 2] & mask4) << 6) | static_cast<uint16_t>(arr[boff + 1] >> 2));
+      store(poff + 2, (static_cast<uint16_t>(arr[boff + 3] & mask6) << 4) | static_cast<uint16_t>(arr[boff + 2] >> 4));
+      store(poff + 3, (static_cast<uint16_t>(arr[boff + 4]) << 2) | static_cast<uint16_t>(arr[boff + 3] >> 6));
     }
   } else if constexpr (sbw == 13) {
-    constexpr size_t itr_cnt = poly.size() >> 3;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 3;
     constexpr uint8_t mask7 = 0b1111111;
     constexpr uint8_t mask6 = mask7 >> 1;
     constexpr uint8_t mask5 = mask6 >> 1;
@@ -238,17 +248,17 @@ decode(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_f
       const size_t poff = i << 3;
       const size_t boff = i * 13;
 
-      poly[poff + 0] = (static_cast<uint32_t>(arr[boff + 1] & mask5) << 8) | static_cast<uint32_t>(arr[boff + 0]);
-      poly[poff + 1] = (static_cast<uint32_t>(arr[boff + 3] & mask2) << 11) | (static_cast<uint32_t>(arr[boff + 2]) << 3) | static_cast<uint32_t>(arr[boff + 1] >> 5);
-      poly[poff + 2] = (static_cast<uint32_t>(arr[boff + 4] & mask7) << 6) | static_cast<uint32_t>(arr[boff + 3] >> 2);
-      poly[poff + 3] = (static_cast<uint32_t>(arr[boff + 6] & mask4) << 9) | (static_cast<uint32_t>(arr[boff + 5]) << 1) | static_cast<uint32_t>(arr[boff + 4] >> 7);
-      poly[poff + 4] = (static_cast<uint32_t>(arr[boff + 8] & mask1) << 12) | (static_cast<uint32_t>(arr[boff + 7]) << 4) | static_cast<uint32_t>(arr[boff + 6] >> 4);
-      poly[poff + 5] = (static_cast<uint32_t>(arr[boff + 9] & mask6) << 7) | static_cast<uint32_t>(arr[boff + 8] >> 1);
-      poly[poff + 6] = (static_cast<uint32_t>(arr[boff + 11] & mask3) << 10) | (static_cast<uint32_t>(arr[boff + 10]) << 2) | static_cast<uint32_t>(arr[boff + 9] >> 6);
-      poly[poff + 7] = (static_cast<uint32_t>(arr[boff + 12]) << 5) | static_cast<uint32_t>(arr[boff + 11] >> 3);
+      store(poff + 0, (static_cast<uint32_t>(arr[boff + 1] & mask5) << 8) | static_cast<uint32_t>(arr[boff + 0]));
+      store(poff + 1, (static_cast<uint32_t>(arr[boff + 3] & mask2) << 11) | (static_cast<uint32_t>(arr[boff + 2]) << 3) | static_cast<uint32_t>(arr[boff + 1] >> 5));
+      store(poff + 2, (static_cast<uint32_t>(arr[boff + 4] & mask7) << 6) | static_cast<uint32_t>(arr[boff + 3] >> 2));
+      store(poff + 3, (static_cast<uint32_t>(arr[boff + 6] & mask4) << 9) | (static_cast<uint32_t>(arr[boff + 5]) << 1) | static_cast<uint32_t>(arr[boff + 4] >> 7));
+      store(poff + 4, (static_cast<uint32_t>(arr[boff + 8] & mask1) << 12) | (static_cast<uint32_t>(arr[boff + 7]) << 4) | static_cast<uint32_t>(arr[boff + 6] >> 4));
+      store(poff + 5, (static_cast<uint32_t>(arr[boff + 9] & mask6) << 7) | static_cast<uint32_t>(arr[boff + 8] >> 1));
+      store(poff + 6, (static_cast<uint32_t>(arr[boff + 11] & mask3) << 10) | (static_cast<uint32_t>(arr[boff + 10]) << 2) | static_cast<uint32_t>(arr[boff + 9] >> 6));
+      store(poff + 7, (static_cast<uint32_t>(arr[boff + 12]) << 5) | static_cast<uint32_t>(arr[boff + 11] >> 3));
     }
   } else if constexpr (sbw == 18) {
-    constexpr size_t itr_cnt = poly.size() >> 2;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 2;
     constexpr uint8_t mask6 = 0b111111;
     constexpr uint8_t mask4 = mask6 >> 2;
     constexpr uint8_t mask2 = mask4 >> 2;
@@ -257,53 +267,135 @@ decode(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_f
       const size_t poff = i << 2;
       const size_t boff = i * 9;
 
-      poly[poff + 0] = (static_cast<uint32_t>(arr[boff + 2] & mask2) << 16) | (static_cast<uint32_t>(arr[boff + 1]) << 8) | static_cast<uint32_t>(arr[boff + 0]);
-      poly[poff + 1] = (static_cast<uint32_t>(arr[boff + 4] & mask4) << 14) | (static_cast<uint32_t>(arr[boff + 3]) << 6) | static_cast<uint32_t>(arr[boff + 2] >> 2);
-      poly[poff + 2] = (static_cast<uint32_t>(arr[boff + 6] & mask6) << 12) | (static_cast<uint32_t>(arr[boff + 5]) << 4) | static_cast<uint32_t>(arr[boff + 4] >> 4);
-      poly[poff + 3] = (static_cast<uint32_t>(arr[boff + 8]) << 10) | (static_cast<uint32_t>(arr[boff + 7]) << 2) | static_cast<uint32_t>(arr[boff + 6] >> 6);
+      store(poff + 0, (static_cast<uint32_t>(arr[boff + 2] & mask2) << 16) | (static_cast<uint32_t>(arr[boff + 1]) << 8) | static_cast<uint32_t>(arr[boff + 0]));
+      store(poff + 1, (static_cast<uint32_t>(arr[boff + 4] & mask4) << 14) | (static_cast<uint32_t>(arr[boff + 3]) << 6) | static_cast<uint32_t>(arr[boff + 2] >> 2));
+      store(poff + 2, (static_cast<uint32_t>(arr[boff + 6] & mask6) << 12) | (static_cast<uint32_t>(arr[boff + 5]) << 4) | static_cast<uint32_t>(arr[boff + 4] >> 4));
+      store(poff + 3, (static_cast<uint32_t>(arr[boff + 8]) << 10) | (static_cast<uint32_t>(arr[boff + 7]) << 2) | static_cast<uint32_t>(arr[boff + 6] >> 6));
     }
   } else if constexpr (sbw == 20) {
-    constexpr size_t itr_cnt = poly.size() >> 1;
+    constexpr size_t itr_cnt = ml_dsa_ntt::N >> 1;
     constexpr uint8_t mask4 = 0b1111;
 
     for (size_t i = 0; i < itr_cnt; i++) {
       const size_t poff = i << 1;
       const size_t boff = i * 5;
 
-      poly[poff + 0] = (static_cast<uint32_t>(arr[boff + 2] & mask4) << 16) | (static_cast<uint32_t>(arr[boff + 1]) << 8) | static_cast<uint32_t>(arr[boff + 0]);
-      poly[poff + 1] = (static_cast<uint32_t>(arr[boff + 4]) << 12) | (static_cast<uint32_t>(arr[boff + 3]) << 4) | static_cast<uint32_t>(arr[boff + 2] >> 4);
+      store(poff + 0, (static_cast<uint32_t>(arr[boff + 2] & mask4) << 16) | (static_cast<uint32_t>(arr[boff + 1]) << 8) | static_cast<uint32_t>(arr[boff + 0]));
+      store(poff + 1, (static_cast<uint32_t>(arr[boff + 4]) << 12) | (static_cast<uint32_t>(arr[boff + 3]) << 4) | static_cast<uint32_t>(arr[boff + 2] >> 4));
     }
   } else {
-    for (size_t i = 0; i < arr.size() * 8; i++) {
-      const size_t aidx = i >> 3;
-      const size_t aoff = i & 7ul;
+    for (size_t i = 0; i < ml_dsa_ntt::N; i++) {
+      uint32_t coeff = 0;
 
-      const size_t pidx = i / sbw;
-      const size_t poff = i % sbw;
+      for (size_t j = 0; j < sbw; j++) {
+        const size_t bidx = i * sbw + j;
+
+        const size_t aidx = bidx >> 3;
+        const size_t aoff = bidx & 7ul;
+
+        const uint8_t bit = (arr[aidx] >> aoff) & 0b1;
+        coeff ^= static_cast<uint32_t>(bit) << j;
+      }
 
-      const uint8_t bit = (arr[aidx] >> aoff) & 0b1;
-      poly[pidx] = poly[pidx].raw() ^ static_cast<uint32_t>(bit) << poff;
+      store(i, coeff);
     }
   }
 }
 
-// Given a vector of hint bits ( of dimension k x 1 ), this routine encodes hint bits into (ω + k) -bytes.
+// Given a degree-255 polynomial, where significant portion of each coefficient ∈ [0, 2^sbw), this
+// routine serializes the polynomial to a byte array of length 32 * sbw -bytes.
+template<size_t sbw>
+static inline constexpr void
+encode(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_t, (ml_dsa_ntt::N * sbw) / std::numeric_limits<uint8_t>::digits> arr)
+  requires(ml_dsa_params::check_sbw(sbw))
+{
+#if defined ML_DSA_DISPATCH_X86_64
+  if (!std::is_constant_evaluated() && ml_dsa_bit_packing_avx::pack<sbw, false, 0u>(poly.data(), arr.data())) {
+    return;
+  }
+#endif
+
+  pack<sbw>([&](const size_t i) -> uint32_t { return poly[i].raw(); }, arr);
+}
+
+// Given a degree-255 polynomial, which has all of its coefficients in [-x, x] ( i.e. centered representation ), this
+// routine serializes the polynomial to a byte array of length 32 * sbw -bytes, by packing x - coeff ∈ [0, 2x].
+//
+// This is equivalent to invoking `encode` on the polynomial, after subtracting each coefficient from x, but it doesn't
+// require mutating the source polynomial, or an extra pass over it.
+template<size_t sbw, uint32_t x>
+static inline constexpr void
+encode_centered(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly, std::span<uint8_t, (ml_dsa_ntt::N * sbw) / std::numeric_limits<uint8_t>::digits> arr)
+  requires(ml_dsa_params::check_sbw(sbw))
+{
+#if defined ML_DSA_DISPATCH_X86_64
+  if (!std::is_constant_evaluated() && ml_dsa_bit_packing_avx::pack<sbw, true, x>(poly.data(), arr.data())) {
+    return;
+  }
+#endif
+
+  constexpr ml_dsa_field::zq_t x_cap(x);
+  pack<sbw>([&](const size_t i) -> uint32_t { return (x_cap - poly[i]).raw(); }, arr);
+}
+
+// Given a byte array of length 32 * sbw -bytes, this routine extracts out 256 coefficients of a degree-255
+// polynomial s.t. significant portion of each coefficient ∈ [0, 2^sbw).
+//
+// This is just the opposite of above `encode` routine.
+template<size_t sbw>
+static inline constexpr void
+decode(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly)
+  requires(ml_dsa_params::check_sbw(sbw))
+{
+#if defined ML_DSA_DISPATCH_X86_64
+  if (!std::is_constant_evaluated() && ml_dsa_bit_packing_avx::unpack<sbw, false, 0u>(arr.data(), poly.data())) {
+    return;
+  }
+#endif
+
+  unpack<sbw>(arr, [&](const size_t i, const uint32_t coeff) { poly[i] = ml_dsa_field::zq_t(coeff); });
+}
+
+// Given a byte array of length 32 * sbw -bytes, holding 256 packed values ∈ [0, 2x], this routine extracts out a
+// degree-255 polynomial, in centered representation, s.t. each coefficient = x - value ∈ [-x, x].
+//
+// This is just the opposite of above `encode_centered` routine.
+template<size_t sbw, uint32_t x>
+static inline constexpr void
+decode_centered(std::span<const uint8_t, ml_dsa_ntt::N * sbw / 8> arr, std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly)
+  requires(ml_dsa_params::check_sbw(sbw))
+{
+#if defined ML_DSA_DISPATCH_X86_64
+  if (!std::is_constant_evaluated() && ml_dsa_bit_packing_avx::unpack<sbw, true, x>(arr.data(), poly.data())) {
+    return;
+  }
+#endif
+
+  constexpr ml_dsa_field::zq_t x_cap(x);
+  unpack<sbw>(arr, [&](const size_t i, const uint32_t coeff) { poly[i] = x_cap - ml_dsa_field::zq_t(coeff); });
+}
+
+// Given a vector of hint bits ( of dimension k x 1 ), kept as k bitsets of 256 -bits each, this routine encodes hint
+// bits into (ω + k) -bytes.
+//
+// Note, every bit position is visited, irrespective of whether it's set or not, so that time taken by this routine
+// doesn't depend on position of set bits.
 //
 // See algorithm 14 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
 template<size_t k, size_t ω>
 static inline constexpr void
-encode_hint_bits(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h, std::span<uint8_t, ω + k> arr)
+encode_hint_bits(std::span<const uint64_t, k * HINT_WORDS_PER_POLY> h, std::span<uint8_t, ω + k> arr)
 {
   std::fill(arr.begin(), arr.end(), 0);
 
-  constexpr auto zero = ml_dsa_field::zq_t::zero();
+  constexpr size_t word_bw = std::numeric_limits<uint64_t>::digits;
   size_t idx = 0;
 
   for (size_t i = 0; i < k; i++) {
-    const size_t off = i * ml_dsa_ntt::N;
+    const size_t off = i * HINT_WORDS_PER_POLY;
 
     for (size_t j = 0; j < ml_dsa_ntt::N; j++) {
-      const bool flg = h[off + j] != zero;
+      const bool flg = static_cast<bool>((h[off + j / word_bw] >> (j % word_bw)) & 0b1ul);
       const uint8_t br[]{ arr[idx], static_cast<uint8_t>(j) };
 
       arr[idx] = br[static_cast<size_t>(flg)];
@@ -315,7 +407,7 @@ encode_hint_bits(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h, std::
 }
 
 // Given a serialized byte array holding hint bits, this routine unpacks hint bits into a vector ( of dimension k x 1 )
-// of degree-255 polynomials s.t. <= ω many hint bits are set.
+// of 256 -bit bitsets s.t. <= ω many hint bits are set.
 //
 // Returns boolean result denoting status of decoding of byte serialized hint bits.
 // For example, say return value is true, it denotes that decoding has failed.
@@ -323,15 +415,17 @@ encode_hint_bits(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h, std::
 // See algorithm 15 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd.
 template<size_t k, size_t ω>
 static inline constexpr bool
-decode_hint_bits(std::span<const uint8_t, ω + k> arr, std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h)
+decode_hint_bits(std::span<const uint8_t, ω + k> arr, std::span<uint64_t, k * HINT_WORDS_PER_POLY> h)
 {
-  std::fill(h.begin(), h.end(), ml_dsa_field::zq_t::zero());
+  std::fill(h.begin(), h.end(), 0ul);
+
+  constexpr size_t word_bw = std::numeric_limits<uint64_t>::digits;
 
   size_t idx = 0;
   bool failed = false;
 
   for (size_t i = 0; i < k; i++) {
-    const size_t off = i * ml_dsa_ntt::N;
+    const size_t off = i * HINT_WORDS_PER_POLY;
 
     const bool flg0 = arr[ω + i] < idx;
     const bool flg1 = arr[ω + i] > ω;
@@ -346,7 +440,7 @@ decode_hint_bits(std::span<const uint8_t, ω + k> arr, std::span<ml_dsa_field::z
 
       failed |= flg1;
 
-      h[off + arr[j]] = ml_dsa_field::zq_t::one();
+      h[off + arr[j] / word_bw] |= 1ul << (arr[j] % word_bw);
     }
 
     idx = arr[ω + i];
@@ -0,0 +1,378 @@
+#pragma once
+#include "ml_dsa/internals/math/field.hpp"
+#include "ml_dsa/internals/utility/dispatch.hpp"
+#include "ntt.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+#if defined ML_DSA_DISPATCH_X86_64
+#include <immintrin.h>
+#endif
+
+// Bit packing/ unpacking of degree-255 polynomials, using AVX2 or AVX512-VBMI instructions, when CPU supports them.
+// Both of these kernels are compiled using `target` function attribute, and selected at runtime, based on active
+// backend, see `ml_dsa_dispatch`.
+//
+// Coefficients are processed in groups of 8 ( AVX2 ) or 16 ( AVX512-VBMI ), so that a group always packs to a whole
+// number of bytes. Packing merges pairs of coefficients inside 64 -bit lanes, shifts each lane to its bit offset and
+// then moves lanes to their byte offsets, using byte shuffles. Unpacking gathers 4 bytes around each coefficient, using
+// byte shuffles and then shifts/ masks it out, using variable shifts. Shuffle indices and shift amounts only depend on
+// sbw, so they are computed at compile-time.
+//
+// Byte serialized output is same as the one produced by scalar `ml_dsa_bit_packing::{pack, unpack}` routines.
+namespace ml_dsa_bit_packing_avx {
+
+// Number of coefficients packed/ unpacked together, by AVX2 and AVX512-VBMI kernels, respectively.
+static constexpr size_t AVX2_GROUP_COEFF_CNT = 8;
+static constexpr size_t AVX512_GROUP_COEFF_CNT = 16;
+
+static_assert(sizeof(ml_dsa_field::zq_t) == sizeof(uint32_t), "Polynomial coefficients must be loadable as 32 -bit lanes !");
+
+// Compile-time check to ensure that coefficients of sbw -bits can be packed/ unpacked with SIMD kernels, which
+// requires sbw ∈ [1, 23].
+consteval bool
+check_sbw(const size_t sbw)
+{
+  return (sbw > 0) && (sbw <= ml_dsa_field::Q_BIT_WIDTH);
+}
+
+// Byte shuffle indices and bit shift amounts, used when unpacking a group of coefficients. Let j -th coefficient of
+// the group start at bit offset (j * sbw), then its 4 bytes starting at byte (j * sbw) / 8 are gathered into j -th 32
+// -bit lane, which is shifted rightwards by (j * sbw) % 8 bits.
+//
+// For AVX2, shuffles are performed inside 128 -bit lanes, so bytes gathered for the upper half of the group are
+// relative to byte offset `upper_base_off`.
+template<size_t sbw, size_t group_size>
+struct unpack_tables_t
+{
+  static constexpr size_t upper_base_off = (sbw * (group_size / 2)) / 8;
+
+  std::array<uint8_t, group_size * 4> shuffle{};
+  std::array<uint32_t, group_size> shift{};
+
+  consteval unpack_tables_t()
+  {
+    for (size_t j = 0; j < group_size; j++) {
+      const size_t bit_off = j * sbw;
+
+      size_t byte_off = bit_off / 8;
+      if constexpr (group_size == 8) {
+        byte_off -= (j >= (group_size / 2)) ? upper_base_off : 0;
+      }
+
+      for (size_t b = 0; b < 4; b++) {
+        shuffle[j * 4 + b] = static_cast<uint8_t>(byte_off + b);
+      }
+
+      shift[j] = static_cast<uint32_t>(bit_off % 8);
+    }
+  }
+};
+
+// Byte shuffle indices, shift amounts and byte masks, used when packing a group of coefficients. Pair of coefficients
+// (2j, 2j + 1) is merged into j -th 64 -bit lane, which holds (2 * sbw) -bits, starting at bit offset (j * 2 * sbw). The
+// lane is shifted leftwards by (j * 2 * sbw) % 8 bits, so that its bytes can be moved to byte offset (j * 2 * sbw) / 8.
+//
+// Neighbouring lanes may share a byte at their boundary, hence bytes of even and odd indexed lanes are moved using two
+// separate shuffles, whose results are OR-ed. Shuffle index 0x80 ( or zero mask bit ) zeroes the destination byte.
+template<size_t sbw, size_t group_size>
+struct pack_tables_t
+{
+  static constexpr size_t lane_cnt = group_size / 2;
+  static constexpr size_t upper_base_off = (sbw * (group_size / 2)) / 8;
+
+  std::array<uint8_t, group_size * 4> shuffle_even{};
+  std::array<uint8_t, group_size * 4> shuffle_odd{};
+  std::array<uint64_t, lane_cnt> shift{};
+  uint64_t mask_even = 0;
+  uint64_t mask_odd = 0;
+
+  consteval pack_tables_t()
+  {
+    std::fill(shuffle_even.begin(), shuffle_even.end(), 0x80);
+    std::fill(shuffle_odd.begin(), shuffle_odd.end(), 0x80);
+
+    for (size_t j = 0; j < lane_cnt; j++) {
+      const size_t bit_off = j * 2 * sbw;
+      const size_t lshift = bit_off % 8;
+      const size_t byte_cnt = (lshift + 2 * sbw + 7) / 8;
+
+      size_t byte_off = bit_off / 8;
+      size_t src_off = j * 8;
+
+      if constexpr (group_size == 8) {
+        // Bytes are moved inside 128 -bit lanes, upper half of the group is relative to `upper_base_off`.
+        const bool is_upper = j >= (lane_cnt / 2);
+
+        byte_off = is_upper ? (byte_off - upper_base_off + 16) : byte_off;
+        src_off = is_upper ? (src_off - 16) : src_off;
+      }
+
+      auto& shuffle = (j & 1) ? shuffle_odd : shuffle_even;
+      auto& mask = (j & 1) ? mask_odd : mask_even;
+
+      for (size_t b = 0; b < byte_cnt; b++) {
+        const size_t dst = byte_off + b;
+
+        shuffle[dst] = static_cast<uint8_t>(src_off + b);
+        mask |= 1ul << dst;
+      }
+
+      shift[j] = lshift;
+    }
+  }
+};
+
+#if defined ML_DSA_DISPATCH_X86_64
+
+// Note, zero-masking variants of AVX512 shift and permute instructions are used, with all lanes enabled, because GCC 12
+// raises false positive uninitialized value warnings for their unmasked variants, see
+// https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105593.
+static constexpr __mmask8 ALL_QWORDS = 0xff;
+static constexpr __mmask16 ALL_DWORDS = 0xffff;
+static constexpr __mmask64 ALL_BYTES = ~0ul;
+
+// Given a group of 16 coefficients, this routine maps them to values to be packed i.e. either keeps significant sbw
+// -bits of each coefficient or computes x - coeff, for coefficients in centered representation.
+template<size_t sbw, bool centered, uint32_t x>
+__attribute__((target("avx512f,avx512bw,avx512vbmi"))) static inline __m512i
+to_packed_values_avx512(const __m512i coeffs)
+{
+  const __m512i mask = _mm512_set1_epi32(static_cast<int>((1u << sbw) - 1u));
+
+  if constexpr (centered) {
+    const __m512i x_vec = _mm512_set1_epi32(static_cast<int>(x));
+    const __m512i q_vec = _mm512_set1_epi32(static_cast<int>(ml_dsa_field::Q));
+
+    const __mmask16 flg = _mm512_cmpgt_epu32_mask(coeffs, x_vec);
+    const __m512i t0 = _mm512_sub_epi32(x_vec, coeffs);
+    const __m512i t1 = _mm512_mask_add_epi32(t0, flg, t0, q_vec);
+
+    return _mm512_and_si512(t1, mask);
+  } else {
+    return _mm512_and_si512(coeffs, mask);
+  }
+}
+
+// Given 256 coefficients of a degree-255 polynomial, this routine serializes them to a byte array of length 32 * sbw
+// -bytes, using AVX512-VBMI instructions.
+template<size_t sbw, bool centered, uint32_t x>
+__attribute__((target("avx512f,avx512bw,avx512vbmi"))) static inline void
+pack_avx512(const ml_dsa_field::zq_t* const __restrict poly, uint8_t* const __restrict arr)
+  requires(check_sbw(sbw))
+{
+  static constexpr pack_tables_t<sbw, AVX512_GROUP_COEFF_CNT> tables{};
+  constexpr __mmask64 store_mask = (2 * sbw == 64) ? ~0ul : ((1ul << (2 * sbw)) - 1ul);
+
+  const __m512i lo32 = _mm512_set1_epi64(0xffffffffl);
+  const __m512i shift = _mm512_loadu_si512(tables.shift.data());
+  const __m512i shuffle_even = _mm512_loadu_si512(tables.shuffle_even.data());
+  const __m512i shuffle_odd = _mm512_loadu_si512(tables.shuffle_odd.data());
+
+  for (size_t i = 0; i < ml_dsa_ntt::N; i += AVX512_GROUP_COEFF_CNT) {
+    const __m512i coeffs = _mm512_loadu_si512(poly + i);
+    const __m512i vals = to_packed_values_avx512<sbw, centered, x>(coeffs);
+
+    const __m512i pairs = _mm512_or_si512(_mm512_and_si512(vals, lo32), _mm512_maskz_slli_epi64(ALL_QWORDS, _mm512_maskz_srli_epi64(ALL_QWORDS, vals, 32), sbw));
+    const __m512i lanes = _mm512_maskz_sllv_epi64(ALL_QWORDS, pairs, shift);
+
+    const __m512i even = _mm512_maskz_permutexvar_epi8(tables.mask_even, shuffle_even, lanes);
+    const __m512i odd = _mm512_maskz_permutexvar_epi8(tables.mask_odd, shuffle_odd, lanes);
+
+    _mm512_mask_storeu_epi8(arr + (i * sbw) / 8, store_mask, _mm512_or_si512(even, odd));
+  }
+}
+
+// Given a byte array of length 32 * sbw -bytes, this routine extracts out 256 coefficients of a degree-255
+// polynomial, using AVX512-VBMI instructions. When `centered` is set, each coefficient is computed as x - value.
+template<size_t sbw, bool centered, uint32_t x>
+__attribute__((target("avx512f,avx512bw,avx512vbmi"))) static inline void
+unpack_avx512(const uint8_t* const __restrict arr, ml_dsa_field::zq_t* const __restrict poly)
+  requires(check_sbw(sbw))
+{
+  static constexpr unpack_tables_t<sbw, AVX512_GROUP_COEFF_CNT> tables{};
+  constexpr __mmask64 load_mask = (2 * sbw == 64) ? ~0ul : ((1ul << (2 * sbw)) - 1ul);
+
+  const __m512i mask = _mm512_set1_epi32(static_cast<int>((1u << sbw) - 1u));
+  const __m512i shift = _mm512_loadu_si512(tables.shift.data());
+  const __m512i shuffle = _mm512_loadu_si512(tables.shuffle.data());
+
+  for (size_t i = 0; i < ml_dsa_ntt::N; i += AVX512_GROUP_COEFF_CNT) {
+    const __m512i bytes = _mm512_maskz_loadu_epi8(load_mask, arr + (i * sbw) / 8);
+    const __m512i words = _mm512_maskz_permutexvar_epi8(ALL_BYTES, shuffle, bytes);
+    const __m512i vals = _mm512_and_si512(_mm512_maskz_srlv_epi32(ALL_DWORDS, words, shift), mask);
+
+    if constexpr (centered) {
+      const __m512i x_vec = _mm512_set1_epi32(static_cast<int>(x));
+      const __m512i q_vec = _mm512_set1_epi32(static_cast<int>(ml_dsa_field::Q));
+
+      const __mmask16 flg = _mm512_cmpgt_epu32_mask(vals, x_vec);
+      const __m512i t0 = _mm512_sub_epi32(x_vec, vals);
+      const __m512i t1 = _mm512_mask_add_epi32(t0, flg, t0, q_vec);
+
+      _mm512_storeu_si512(poly + i, t1);
+    } else {
+      _mm512_storeu_si512(poly + i, vals);
+    }
+  }
+}
+
+
+// Given a group of 8 coefficients, this routine maps them to values to be packed i.e. either keeps significant sbw
+// -bits of each coefficient or computes x - coeff, for coefficients in centered representation.
+template<size_t sbw, bool centered, uint32_t x>
+__attribute__((target("avx2"))) static inline __m256i
+to_packed_values_avx2(const __m256i coeffs)
+{
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>((1u << sbw) - 1u));
+
+  if constexpr (centered) {
+    // Both operands < 2^31, so signed comparison works
+    const __m256i x_vec = _mm256_set1_epi32(static_cast<int>(x));
+    const __m256i q_vec = _mm256_set1_epi32(static_cast<int>(ml_dsa_field::Q));
+
+    const __m256i flg = _mm256_cmpgt_epi32(coeffs, x_vec);
+    const __m256i t0 = _mm256_sub_epi32(x_vec, coeffs);
+    const __m256i t1 = _mm256_add_epi32(t0, _mm256_and_si256(flg, q_vec));
+
+    return _mm256_and_si256(t1, mask);
+  } else {
+    return _mm256_and_si256(coeffs, mask);
+  }
+}
+
+// Given 256 coefficients of a degree-255 polynomial, this routine serializes them to a byte array of length 32 * sbw
+// -bytes, using AVX2 instructions.
+template<size_t sbw, bool centered, uint32_t x>
+__attribute__((target("avx2"))) static inline void
+pack_avx2(const ml_dsa_field::zq_t* const __restrict poly, uint8_t* const __restrict arr)
+  requires(check_sbw(sbw))
+{
+  static constexpr pack_tables_t<sbw, AVX2_GROUP_COEFF_CNT> tables{};
+  constexpr int upper_base_off = static_cast<int>(pack_tables_t<sbw, AVX2_GROUP_COEFF_CNT>::upper_base_off);
+
+  const __m256i lo32 = _mm256_set1_epi64x(0xffffffffl);
+  const __m256i shift = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.shift.data()));
+  const __m256i shuffle_even = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.shuffle_even.data()));
+  const __m256i shuffle_odd = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.shuffle_odd.data()));
+
+  for (size_t i = 0; i < ml_dsa_ntt::N; i += AVX2_GROUP_COEFF_CNT) {
+    const __m256i coeffs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(poly + i));
+    const __m256i vals = to_packed_values_avx2<sbw, centered, x>(coeffs);
+
+    const __m256i pairs = _mm256_or_si256(_mm256_and_si256(vals, lo32), _mm256_slli_epi64(_mm256_srli_epi64(vals, 32), sbw));
+    const __m256i lanes = _mm256_sllv_epi64(pairs, shift);
+
+    const __m256i even = _mm256_shuffle_epi8(lanes, shuffle_even);
+    const __m256i odd = _mm256_shuffle_epi8(lanes, shuffle_odd);
+    const __m256i both = _mm256_or_si256(even, odd);
+
+    // Lower half holds bytes [0, 16), upper half holds bytes [upper_base_off, upper_base_off + 16)
+    const __m128i lo = _mm256_castsi256_si128(both);
+    const __m128i hi = _mm256_extracti128_si256(both, 1);
+
+    alignas(32) std::array<uint8_t, 32> res{};
+    _mm_store_si128(reinterpret_cast<__m128i*>(res.data()), _mm_or_si128(lo, _mm_slli_si128(hi, upper_base_off)));
+    _mm_store_si128(reinterpret_cast<__m128i*>(res.data() + 16), _mm_srli_si128(hi, 16 - upper_base_off));
+
+    std::memcpy(arr + (i * sbw) / 8, res.data(), sbw);
+  }
+}
+
+// Given a byte array of length 32 * sbw -bytes, this routine extracts out 256 coefficients of a degree-255
+// polynomial, using AVX2 instructions. When `centered` is set, each coefficient is computed as x - value.
+template<size_t sbw, bool centered, uint32_t x>
+__attribute__((target("avx2"))) static inline void
+unpack_avx2(const uint8_t* const __restrict arr, ml_dsa_field::zq_t* const __restrict poly)
+  requires(check_sbw(sbw))
+{
+  static constexpr unpack_tables_t<sbw, AVX2_GROUP_COEFF_CNT> tables{};
+  constexpr size_t upper_base_off = unpack_tables_t<sbw, AVX2_GROUP_COEFF_CNT>::upper_base_off;
+
+  // Last byte read by a group, when loading 16 bytes from `upper_base_off`, must stay inside the byte array, otherwise
+  // the group is first copied to a zero padded buffer.
+  constexpr size_t arr_len = (ml_dsa_ntt::N * sbw) / 8;
+  constexpr size_t load_len = upper_base_off + 16;
+
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>((1u << sbw) - 1u));
+  const __m256i shift = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.shift.data()));
+  const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.shuffle.data()));
+
+  for (size_t i = 0; i < ml_dsa_ntt::N; i += AVX2_GROUP_COEFF_CNT) {
+    const size_t off = (i * sbw) / 8;
+
+    alignas(32) std::array<uint8_t, 32> buf{};
+    const uint8_t* src = arr + off;
+
+    if ((off + load_len) > arr_len) {
+      std::memcpy(buf.data(), src, sbw);
+      src = buf.data();
+    }
+
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + upper_base_off));
+
+    const __m256i bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    const __m256i words = _mm256_shuffle_epi8(bytes, shuffle);
+    const __m256i vals = _mm256_and_si256(_mm256_srlv_epi32(words, shift), mask);
+
+    if constexpr (centered) {
+      const __m256i x_vec = _mm256_set1_epi32(static_cast<int>(x));
+      const __m256i q_vec = _mm256_set1_epi32(static_cast<int>(ml_dsa_field::Q));
+
+      const __m256i flg = _mm256_cmpgt_epi32(vals, x_vec);
+      const __m256i t0 = _mm256_sub_epi32(x_vec, vals);
+      const __m256i t1 = _mm256_add_epi32(t0, _mm256_and_si256(flg, q_vec));
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(poly + i), t1);
+    } else {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(poly + i), vals);
+    }
+  }
+}
+
+// Given 256 coefficients of a degree-255 polynomial, this routine serializes them to a byte array of length 32 * sbw
+// -bytes, using SIMD kernel of active backend, returning boolean truth value. In case active backend is scalar, it
+// returns false, without touching the byte array, so that the caller can fall back to scalar routine.
+template<size_t sbw, bool centered, uint32_t x>
+static inline bool
+pack(const ml_dsa_field::zq_t* const __restrict poly, uint8_t* const __restrict arr)
+  requires(check_sbw(sbw))
+{
+  switch (ml_dsa_dispatch::active_backend()) {
+    case ml_dsa_dispatch::backend_t::avx512:
+      pack_avx512<sbw, centered, x>(poly, arr);
+      return true;
+    case ml_dsa_dispatch::backend_t::avx2:
+      pack_avx2<sbw, centered, x>(poly, arr);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Given a byte array of length 32 * sbw -bytes, this routine extracts out 256 coefficients of a degree-255
+// polynomial, using SIMD kernel of active backend, returning boolean truth value. In case active backend is scalar, it
+// returns false, without touching the polynomial, so that the caller can fall back to scalar routine.
+template<size_t sbw, bool centered, uint32_t x>
+static inline bool
+unpack(const uint8_t* const __restrict arr, ml_dsa_field::zq_t* const __restrict poly)
+  requires(check_sbw(sbw))
+{
+  switch (ml_dsa_dispatch::active_backend()) {
+    case ml_dsa_dispatch::backend_t::avx512:
+      unpack_avx512<sbw, centered, x>(arr, poly);
+      return true;
+    case ml_dsa_dispatch::backend_t::avx2:
+      unpack_avx2<sbw, centered, x>(arr, poly);
+      return true;
+    default:
+      return false;
+  }
+}
+
+#endif
+
+}
@@ -1,9 +1,12 @@
 #pragma once
+#include "bit_packing.hpp"
 #include "ml_dsa/internals/math/field.hpp"
 #include "ml_dsa/internals/math/reduction.hpp"
 #include "ml_dsa/internals/utility/params.hpp"
 #include "ntt.hpp"
 #include <algorithm>
+#include <bit>
+#include <limits>
 
 // Degree-255 polynomial arithmetic
 namespace ml_dsa_poly {
@@ -37,22 +40,6 @@ mul(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> polya, std::span<const ml
   }
 }
 
-// Given a degree-255 polynomial, which has all of its coefficients in [-x, x], this routine subtracts each coefficient
-// from x, so that they stay in [0, 2x].
-template<uint32_t x>
-static inline constexpr void
-sub_from_x(std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly)
-{
-  constexpr ml_dsa_field::zq_t x_cap(x);
-
-#if defined __clang__
-#pragma clang loop unroll(enable) vectorize(enable) interleave(enable)
-#endif
-  for (size_t i = 0; i < poly.size(); i++) {
-    poly[i] = x_cap - poly[i];
-  }
-}
-
 // Given a degree-255 polynomial, this routine extracts out high order bits.
 template<uint32_t alpha>
 static inline constexpr void
@@ -73,6 +60,22 @@ lowbits(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> src, std::span<ml_dsa
   }
 }
 
+// Given a degree-255 polynomial, this routine extracts out both high and low order bits, in a single pass.
+template<uint32_t alpha>
+static inline constexpr void
+decompose(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> src,
+          std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> hi,
+          std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> lo)
+{
+  for (size_t i = 0; i < src.size(); i++) {
+    const auto s = ml_dsa_reduction::decompose<alpha>(src[i]);
+
+    // Copying out raw values, instead of zq_t members of the pair, lets compiler vectorize this loop
+    hi[i] = ml_dsa_field::zq_t(s.first.raw());
+    lo[i] = ml_dsa_field::zq_t(s.second.raw());
+  }
+}
+
 // Computes infinity norm of a degree-255 polynomial.
 //
 // See line 462 of ML-DSA draft standard https://doi.org/10.6028/NIST.FIPS.204.ipd.
@@ -100,42 +103,77 @@ infinity_norm(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly)
   return res;
 }
 
-// Given two degree-255 polynomials, this routine computes hint bit for each coefficient.
+// Given two degree-255 polynomials, this routine computes hint bit for each coefficient, collecting them in a 256 -bit
+// bitset.
 template<uint32_t alpha>
 static inline constexpr void
 make_hint(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> polya,
           std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> polyb,
-          std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> polyc)
+          std::span<uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint)
 {
-  for (size_t i = 0; i < polya.size(); i++) {
-    polyc[i] = ml_dsa_reduction::make_hint<alpha>(polya[i], polyb[i]);
+  constexpr size_t word_bw = std::numeric_limits<uint64_t>::digits;
+
+  for (size_t i = 0; i < hint.size(); i++) {
+    const size_t off = i * word_bw;
+    uint64_t word = 0;
+
+    for (size_t j = 0; j < word_bw; j++) {
+      const uint64_t bit = ml_dsa_reduction::make_hint<alpha>(polya[off + j], polyb[off + j]).raw();
+      word |= bit << j;
+    }
+
+    hint[i] = word;
+  }
+}
+
+// Given low order bits of `w - cs2 + ct0` and high order bits of `w`, as two degree-255 polynomials, this routine
+// computes hint bit for each coefficient, using `make_hint_decomposed` routine, collecting them in a 256 -bit bitset.
+template<uint32_t alpha>
+static inline constexpr void
+make_hint_decomposed(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> polyr0,
+                     std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> polyr1,
+                     std::span<uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint)
+{
+  constexpr size_t word_bw = std::numeric_limits<uint64_t>::digits;
+
+  for (size_t i = 0; i < hint.size(); i++) {
+    const size_t off = i * word_bw;
+    uint64_t word = 0;
+
+    for (size_t j = 0; j < word_bw; j++) {
+      const uint64_t bit = ml_dsa_reduction::make_hint_decomposed<alpha>(polyr0[off + j], polyr1[off + j]).raw();
+      word |= bit << j;
+    }
+
+    hint[i] = word;
   }
 }
 
-// Given a hint bit polynomial (of degree-255) and another degree-255 polynomial r with arbitrary coefficients ∈
-// Z_q, this routine recovers high order bits of r + z s.t. hint bit was computed using `make_hint` routine and z is
-// another degree-255 polynomial with small coefficients.
+// Given a 256 -bit hint bitset and a degree-255 polynomial r with arbitrary coefficients ∈ Z_q, this routine recovers
+// high order bits of r + z s.t. hint bits were computed using `make_hint` routine and z is another degree-255
+// polynomial with small coefficients.
 template<uint32_t alpha>
 static inline constexpr void
-use_hint(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> polyh,
+use_hint(std::span<const uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint,
          std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> polyr,
          std::span<ml_dsa_field::zq_t, ml_dsa_ntt::N> polyrz)
 {
-  for (size_t i = 0; i < polyh.size(); i++) {
-    polyrz[i] = ml_dsa_reduction::use_hint<alpha>(polyh[i], polyr[i]);
+  constexpr size_t word_bw = std::numeric_limits<uint64_t>::digits;
+
+  for (size_t i = 0; i < polyr.size(); i++) {
+    const ml_dsa_field::zq_t h{ static_cast<uint32_t>((hint[i / word_bw] >> (i % word_bw)) & 0b1ul) };
+    polyrz[i] = ml_dsa_reduction::use_hint<alpha>(h, polyr[i]);
   }
 }
 
-// Given a degree-255 polynomial, this routine counts number of coefficients having value 1.
-// Note, following implementation makes an assumption, coefficieints of input polynomial must be either 0 or 1.
-// In case, one invokes this function with arbitrary polynomial, expect wrong result.
+// Given a 256 -bit hint bitset of a degree-255 polynomial, this routine counts number of hint bits being set.
 static inline constexpr size_t
-count_1s(std::span<const ml_dsa_field::zq_t, ml_dsa_ntt::N> poly)
+count_1s(std::span<const uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint)
 {
   size_t count = 0;
 
-  for (auto coeff : poly) {
-    count += coeff.raw();
+  for (auto word : hint) {
+    count += static_cast<size_t>(std::popcount(word));
   }
 
   return count;
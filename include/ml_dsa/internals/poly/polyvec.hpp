@@ -48,7 +48,9 @@ power2round(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> poly,
 }
 
 // Given two matrices ( in NTT domain ) of compatible dimension, where each matrix element is a degree-255 polynomial
-// over Z_q, this routine multiplies them, computing resulting matrix.
+// over Z_q, this routine multiplies them, computing resulting matrix. Each element of the first matrix is multiplied by
+// all elements of respective row of the second matrix, before moving on, so that it's loaded from memory only once,
+// when the second matrix holds many column vectors.
 template<size_t a_rows, size_t a_cols, size_t b_rows, size_t b_cols>
 static inline constexpr void
 matrix_multiply(std::span<const ml_dsa_field::zq_t, a_rows * a_cols * ml_dsa_ntt::N> a,
@@ -60,12 +62,12 @@ matrix_multiply(std::span<const ml_dsa_field::zq_t, a_rows * a_cols * ml_dsa_ntt
   auto tmp_span = poly_t(tmp);
 
   for (size_t i = 0; i < a_rows; i++) {
-    for (size_t j = 0; j < b_cols; j++) {
-      const size_t coff = (i * b_cols + j) * ml_dsa_ntt::N;
+    for (size_t k = 0; k < a_cols; k++) {
+      const size_t aoff = (i * a_cols + k) * ml_dsa_ntt::N;
 
-      for (size_t k = 0; k < a_cols; k++) {
-        const size_t aoff = (i * a_cols + k) * ml_dsa_ntt::N;
+      for (size_t j = 0; j < b_cols; j++) {
         const size_t boff = (k * b_cols + j) * ml_dsa_ntt::N;
+        const size_t coff = (i * b_cols + j) * ml_dsa_ntt::N;
 
         ml_dsa_poly::mul(const_poly_t(a.subspan(aoff, ml_dsa_ntt::N)), const_poly_t(b.subspan(boff, ml_dsa_ntt::N)), tmp_span);
 
@@ -77,44 +79,69 @@ matrix_multiply(std::span<const ml_dsa_field::zq_t, a_rows * a_cols * ml_dsa_ntt
   }
 }
 
-// Given a vector ( of dimension k x 1 ) of degree-255 polynomials, this routine adds it to another polynomial vector of
-// same dimension s.t. destination vector is mutated.
-template<size_t k>
+// Given a matrix ( of dimension k x l, in NTT domain ) of degree-255 polynomials, each serialized using sbw -bits per
+// coefficient ( see `encode` ), and a matrix ( of dimension l x b_cols, in NTT domain ), this routine multiplies them,
+// computing resulting matrix of dimension k x b_cols. Each polynomial of the first matrix is unpacked, right before
+// it's multiplied by respective row of the second matrix, into a scratch polynomial, which stays in L1 cache, so that
+// the matrix is never expanded in memory, while each polynomial is unpacked only once, for all columns.
+template<size_t k, size_t l, size_t sbw, size_t b_cols = 1>
 static inline constexpr void
-add_to(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> src, std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> dst)
+matrix_multiply_packed(std::span<const uint8_t, (k * l * sbw * ml_dsa_ntt::N) / std::numeric_limits<uint8_t>::digits> a,
+                       std::span<const ml_dsa_field::zq_t, l * b_cols * ml_dsa_ntt::N> b,
+                       std::span<ml_dsa_field::zq_t, k * b_cols * ml_dsa_ntt::N> c)
 {
+  // Byte length of degree-255 polynomial after serialization
+  constexpr size_t poly_blen = a.size() / (k * l);
+
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> a_poly{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> tmp{};
+
   for (size_t i = 0; i < k; i++) {
-    const size_t off = i * ml_dsa_ntt::N;
+    for (size_t j = 0; j < l; j++) {
+      const size_t aoff = (i * l + j) * poly_blen;
+      ml_dsa_bit_packing::decode<sbw>(std::span<const uint8_t, poly_blen>(a.subspan(aoff, poly_blen)), a_poly);
 
-    for (size_t l = 0; l < ml_dsa_ntt::N; l++) {
-      dst[off + l] += src[off + l];
+      for (size_t n = 0; n < b_cols; n++) {
+        const size_t boff = (j * b_cols + n) * ml_dsa_ntt::N;
+        const size_t coff = (i * b_cols + n) * ml_dsa_ntt::N;
+
+        ml_dsa_poly::mul(a_poly, const_poly_t(b.subspan(boff, ml_dsa_ntt::N)), tmp);
+
+        for (size_t m = 0; m < tmp.size(); m++) {
+          c[coff + m] += tmp[m];
+        }
+      }
     }
   }
 }
 
-// Given a vector ( of dimension k x 1 ) of degree-255 polynomials, this routine negates each coefficient.
+// Given a vector ( of dimension k x 1 ) of degree-255 polynomials, this routine adds it to another polynomial vector of
+// same dimension s.t. destination vector is mutated.
 template<size_t k>
 static inline constexpr void
-neg(std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> vec)
+add_to(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> src, std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> dst)
 {
   for (size_t i = 0; i < k; i++) {
     const size_t off = i * ml_dsa_ntt::N;
 
     for (size_t l = 0; l < ml_dsa_ntt::N; l++) {
-      vec[off + l] = -vec[off + l];
+      dst[off + l] += src[off + l];
     }
   }
 }
 
-// Given a vector ( of dimension k x 1 ) of degree-255 polynomials s.t. each coefficient ∈ [-x, x], this routine
-// subtracts each coefficient from x so that coefficients now stay in [0, 2x].
-template<size_t k, uint32_t x>
+// Given a vector ( of dimension k x 1 ) of degree-255 polynomials, this routine subtracts it from another polynomial
+// vector of same dimension s.t. destination vector is mutated.
+template<size_t k>
 static inline constexpr void
-sub_from_x(std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> vec)
+sub_from(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> src, std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> dst)
 {
   for (size_t i = 0; i < k; i++) {
     const size_t off = i * ml_dsa_ntt::N;
-    ml_dsa_poly::sub_from_x<x>(poly_t(vec.subspan(off, ml_dsa_ntt::N)));
+
+    for (size_t l = 0; l < ml_dsa_ntt::N; l++) {
+      dst[off + l] -= src[off + l];
+    }
   }
 }
 
@@ -152,6 +179,65 @@ decode(std::span<const uint8_t, (k * sbw * ml_dsa_ntt::N) / std::numeric_limits<
   }
 }
 
+// Given a vector ( of dimension k x 1 ) of degree-255 polynomials s.t. each coefficient ∈ [-x, x], this routine
+// encodes each of those polynomials into 32 x sbw -bytes, after mapping coefficients to [0, 2x], writing to a
+// (k x 32 x sbw) -bytes destination array.
+template<size_t k, size_t sbw, uint32_t x>
+static inline constexpr void
+encode_centered(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> src,
+                std::span<uint8_t, (k * sbw * ml_dsa_ntt::N) / std::numeric_limits<uint8_t>::digits> dst)
+{
+  // Byte length of degree-255 polynomial after serialization
+  constexpr size_t poly_blen = dst.size() / k;
+
+  for (size_t i = 0; i < k; i++) {
+    const size_t off0 = i * ml_dsa_ntt::N;
+    const size_t off1 = i * poly_blen;
+
+    ml_dsa_bit_packing::encode_centered<sbw, x>(const_poly_t(src.subspan(off0, ml_dsa_ntt::N)), std::span<uint8_t, poly_blen>(dst.subspan(off1, poly_blen)));
+  }
+}
+
+// Given a byte array of length (k x 32 x sbw) -bytes, this routine decodes them into k degree-255 polynomials, mapping
+// each of the packed values ∈ [0, 2x] back to [-x, x], writing them to a column vector of dimension k x 1.
+template<size_t k, size_t sbw, uint32_t x>
+static inline constexpr void
+decode_centered(std::span<const uint8_t, (k * sbw * ml_dsa_ntt::N) / std::numeric_limits<uint8_t>::digits> src,
+                std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> dst)
+{
+  // Byte length of degree-255 polynomial after serialization
+  constexpr size_t poly_blen = src.size() / k;
+
+  for (size_t i = 0; i < k; i++) {
+    const size_t off0 = i * poly_blen;
+    const size_t off1 = i * ml_dsa_ntt::N;
+
+    ml_dsa_bit_packing::decode_centered<sbw, x>(std::span<const uint8_t, poly_blen>(src.subspan(off0, poly_blen)), poly_t(dst.subspan(off1, ml_dsa_ntt::N)));
+  }
+}
+
+// Given a byte array of length (k x 32 x sbw) -bytes, this routine decodes them into k degree-255 polynomials with
+// coefficients in [-x, x], and transforms each of them to its NTT representation, right after decoding it, while the
+// polynomial is still hot in cache. This fuses `decode_centered` and `ntt` into a single pass over the vector.
+template<size_t k, size_t sbw, uint32_t x>
+static inline constexpr void
+decode_centered_ntt(std::span<const uint8_t, (k * sbw * ml_dsa_ntt::N) / std::numeric_limits<uint8_t>::digits> src,
+                    std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> dst)
+{
+  // Byte length of degree-255 polynomial after serialization
+  constexpr size_t poly_blen = src.size() / k;
+
+  for (size_t i = 0; i < k; i++) {
+    const size_t off0 = i * poly_blen;
+    const size_t off1 = i * ml_dsa_ntt::N;
+
+    auto poly = poly_t(dst.subspan(off1, ml_dsa_ntt::N));
+
+    ml_dsa_bit_packing::decode_centered<sbw, x>(std::span<const uint8_t, poly_blen>(src.subspan(off0, poly_blen)), poly);
+    ml_dsa_ntt::ntt(poly);
+  }
+}
+
 // Given a vector (of dimension k x 1) of degree-255 polynomials, it extracts out high order bits from each coefficient.
 template<size_t k, uint32_t alpha>
 static inline constexpr void
@@ -174,6 +260,22 @@ lowbits(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> src, std::span<ml
   }
 }
 
+// Given a vector (of dimension k x 1) of degree-255 polynomials, it extracts out both high and low order bits from each
+// coefficient, in a single pass.
+template<size_t k, uint32_t alpha>
+static inline constexpr void
+decompose(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> src,
+          std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> hi,
+          std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> lo)
+{
+  for (size_t i = 0; i < k; i++) {
+    const size_t off = i * ml_dsa_ntt::N;
+    ml_dsa_poly::decompose<alpha>(const_poly_t(src.subspan(off, ml_dsa_ntt::N)),
+                                  poly_t(hi.subspan(off, ml_dsa_ntt::N)),
+                                  poly_t(lo.subspan(off, ml_dsa_ntt::N)));
+  }
+}
+
 // Given a vector ( of dimension k x 1 ) of degree-255 polynomials and one multiplier polynomial, this routine performs
 // k pointwise polynomial multiplications when each of these polynomials are in their NTT representation.
 template<size_t k>
@@ -204,45 +306,77 @@ infinity_norm(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> vec)
 }
 
 // Given two vectors (of dimension k x 1) of degree-255 polynomials, this routine computes hint bit for each
-// coefficient, using `make_hint` routine.
+// coefficient, using `make_hint` routine, collecting them in k bitsets of 256 -bits each.
 template<size_t k, uint32_t alpha>
 static inline constexpr void
 make_hint(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polya,
           std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polyb,
-          std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polyc)
+          std::span<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint)
 {
+  using hint_t = std::span<uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY>;
+
   for (size_t i = 0; i < k; i++) {
-    const size_t off = i * ml_dsa_ntt::N;
-    ml_dsa_poly::make_hint<alpha>(
-      const_poly_t(polya.subspan(off, ml_dsa_ntt::N)), const_poly_t(polyb.subspan(off, ml_dsa_ntt::N)), poly_t(polyc.subspan(off, ml_dsa_ntt::N)));
+    const size_t off0 = i * ml_dsa_ntt::N;
+    const size_t off1 = i * ml_dsa_bit_packing::HINT_WORDS_PER_POLY;
+
+    ml_dsa_poly::make_hint<alpha>(const_poly_t(polya.subspan(off0, ml_dsa_ntt::N)),
+                                  const_poly_t(polyb.subspan(off0, ml_dsa_ntt::N)),
+                                  hint_t(hint.subspan(off1, ml_dsa_bit_packing::HINT_WORDS_PER_POLY)));
+  }
+}
+
+// Given low order bits of `w - cs2 + ct0` and high order bits of `w`, as two vectors (of dimension k x 1) of degree-255
+// polynomials, this routine computes hint bit for each coefficient, using `make_hint_decomposed` routine, collecting them
+// in k bitsets of 256 -bits each.
+template<size_t k, uint32_t alpha>
+static inline constexpr void
+make_hint_decomposed(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polyr0,
+                     std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polyr1,
+                     std::span<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint)
+{
+  using hint_t = std::span<uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY>;
+
+  for (size_t i = 0; i < k; i++) {
+    const size_t off0 = i * ml_dsa_ntt::N;
+    const size_t off1 = i * ml_dsa_bit_packing::HINT_WORDS_PER_POLY;
+
+    ml_dsa_poly::make_hint_decomposed<alpha>(const_poly_t(polyr0.subspan(off0, ml_dsa_ntt::N)),
+                                             const_poly_t(polyr1.subspan(off0, ml_dsa_ntt::N)),
+                                             hint_t(hint.subspan(off1, ml_dsa_bit_packing::HINT_WORDS_PER_POLY)));
   }
 }
 
-// Recovers high order bits of a vector of degree-255 polynomials (i.e. r + z) s.t. hint bits (say h) and another
+// Recovers high order bits of a vector of degree-255 polynomials (i.e. r + z) s.t. hint bitsets (say h) and another
 // polynomial vector (say r) are provided.
 template<size_t k, uint32_t alpha>
 static inline constexpr void
-use_hint(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polyh,
+use_hint(std::span<const uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint,
          std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polyr,
          std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> polyrz)
 {
+  using const_hint_t = std::span<const uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY>;
+
   for (size_t i = 0; i < k; i++) {
-    const size_t off = i * ml_dsa_ntt::N;
-    ml_dsa_poly::use_hint<alpha>(
-      const_poly_t(polyh.subspan(off, ml_dsa_ntt::N)), const_poly_t(polyr.subspan(off, ml_dsa_ntt::N)), poly_t(polyrz.subspan(off, ml_dsa_ntt::N)));
+    const size_t off0 = i * ml_dsa_bit_packing::HINT_WORDS_PER_POLY;
+    const size_t off1 = i * ml_dsa_ntt::N;
+
+    ml_dsa_poly::use_hint<alpha>(const_hint_t(hint.subspan(off0, ml_dsa_bit_packing::HINT_WORDS_PER_POLY)),
+                                 const_poly_t(polyr.subspan(off1, ml_dsa_ntt::N)),
+                                 poly_t(polyrz.subspan(off1, ml_dsa_ntt::N)));
   }
 }
 
-// Given a vector (of dimension k x 1) of degree-255 polynomials, it counts number of coefficients having value 1.
+// Given a vector (of dimension k x 1) of 256 -bit hint bitsets, it counts number of hint bits being set.
 template<size_t k>
 static inline constexpr size_t
-count_1s(std::span<const ml_dsa_field::zq_t, k * ml_dsa_ntt::N> vec)
+count_1s(std::span<const uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint)
 {
+  using const_hint_t = std::span<const uint64_t, ml_dsa_bit_packing::HINT_WORDS_PER_POLY>;
   size_t cnt = 0;
 
   for (size_t i = 0; i < k; i++) {
-    const size_t off = i * ml_dsa_ntt::N;
-    cnt += ml_dsa_poly::count_1s(const_poly_t(vec.subspan(off, ml_dsa_ntt::N)));
+    const size_t off = i * ml_dsa_bit_packing::HINT_WORDS_PER_POLY;
+    cnt += ml_dsa_poly::count_1s(const_hint_t(hint.subspan(off, ml_dsa_bit_packing::HINT_WORDS_PER_POLY)));
   }
 
   return cnt;
@@ -165,8 +165,7 @@ expand_mask(std::span<const uint8_t, 64> seed, const uint16_t nonce, std::span<m
     hasher.finalize();
     hasher.squeeze(buf_span);
 
-    ml_dsa_bit_packing::decode<gbw>(buf, poly_t(vec.subspan(off, ml_dsa_ntt::N)));
-    ml_dsa_poly::sub_from_x<γ1>(poly_t(vec.subspan(off, ml_dsa_ntt::N)));
+    ml_dsa_bit_packing::decode_centered<gbw, γ1>(buf, poly_t(vec.subspan(off, ml_dsa_ntt::N)));
   }
 }
 
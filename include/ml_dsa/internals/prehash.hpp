@@ -0,0 +1,142 @@
+#pragma once
+#include "sha3_256.hpp"
+#include "sha3_512.hpp"
+#include "shake128.hpp"
+#include "shake256.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
+
+// Pre-hash functions of HashML-DSA
+//
+// HashML-DSA ( see section 5.4 of FIPS 204 ) signs digest of the message, computed using an approved hash function or
+// XOF, rather than the message itself, so that a large message can be digested once, in streaming fashion, on any
+// host, while the signer only handles a fixed size digest, along with object identifier of the pre-hash function.
+// Pre-hash functions, offered by the SHA3 dependency, are supported.
+namespace ml_dsa_prehash {
+
+// Pre-hash functions, as listed in section 5.4.1 of FIPS 204, with XOFs producing 256 -bits and 512 -bits digests.
+enum class hash_t : uint8_t
+{
+  sha3_256 = 0,
+  sha3_512 = 1,
+  shake128 = 2,
+  shake256 = 3,
+};
+
+// Byte length of DER encoded object identifier of a pre-hash function.
+static constexpr size_t OID_BYTE_LEN = 11;
+
+// Hasher, digest length and object identifier of each pre-hash function.
+template<hash_t hash>
+struct traits_t;
+
+template<>
+struct traits_t<hash_t::sha3_256>
+{
+  using hasher_t = sha3_256::sha3_256_t;
+  static constexpr size_t DIGEST_BYTE_LEN = 32;
+  static constexpr std::array<uint8_t, OID_BYTE_LEN> OID = { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x08 };
+};
+
+template<>
+struct traits_t<hash_t::sha3_512>
+{
+  using hasher_t = sha3_512::sha3_512_t;
+  static constexpr size_t DIGEST_BYTE_LEN = 64;
+  static constexpr std::array<uint8_t, OID_BYTE_LEN> OID = { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x0a };
+};
+
+template<>
+struct traits_t<hash_t::shake128>
+{
+  using hasher_t = shake128::shake128_t;
+  static constexpr size_t DIGEST_BYTE_LEN = 32;
+  static constexpr std::array<uint8_t, OID_BYTE_LEN> OID = { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x0b };
+};
+
+template<>
+struct traits_t<hash_t::shake256>
+{
+  using hasher_t = shake256::shake256_t;
+  static constexpr size_t DIGEST_BYTE_LEN = 64;
+  static constexpr std::array<uint8_t, OID_BYTE_LEN> OID = { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x0c };
+};
+
+// Byte length of digest, produced by given pre-hash function.
+template<hash_t hash>
+static constexpr size_t DIGEST_BYTE_LEN = traits_t<hash>::DIGEST_BYTE_LEN;
+
+// Longest digest, produced by any of the pre-hash functions.
+static constexpr size_t MAX_DIGEST_BYTE_LEN = 64;
+
+// Given a pre-hash function, this routine returns byte length of its digest, or 0, if it's not a supported one.
+static inline constexpr size_t
+digest_byte_len(const hash_t hash)
+{
+  switch (hash) {
+    case hash_t::sha3_256:
+      return DIGEST_BYTE_LEN<hash_t::sha3_256>;
+    case hash_t::sha3_512:
+      return DIGEST_BYTE_LEN<hash_t::sha3_512>;
+    case hash_t::shake128:
+      return DIGEST_BYTE_LEN<hash_t::shake128>;
+    case hash_t::shake256:
+      return DIGEST_BYTE_LEN<hash_t::shake256>;
+    default:
+      return 0;
+  }
+}
+
+// Given a supported pre-hash function, this routine returns its DER encoded object identifier.
+static inline constexpr std::span<const uint8_t, OID_BYTE_LEN>
+oid(const hash_t hash)
+{
+  switch (hash) {
+    case hash_t::sha3_256:
+      return traits_t<hash_t::sha3_256>::OID;
+    case hash_t::sha3_512:
+      return traits_t<hash_t::sha3_512>::OID;
+    case hash_t::shake128:
+      return traits_t<hash_t::shake128>::OID;
+    default:
+      return traits_t<hash_t::shake256>::OID;
+  }
+}
+
+// Streaming pre-hash of a message, which can be absorbed in arbitrary sized chunks, as they become available ( say,
+// while reading a large file ), before producing the digest, which is signed or verified by HashML-DSA.
+template<hash_t hash>
+class prehasher_t
+{
+  typename traits_t<hash>::hasher_t hasher{};
+
+public:
+  static constexpr size_t DIGEST_BYTE_LEN = traits_t<hash>::DIGEST_BYTE_LEN;
+
+  // Absorbs next chunk of the message.
+  constexpr void absorb(std::span<const uint8_t> chunk) { hasher.absorb(chunk); }
+
+  // Finalizes the hasher and writes digest of all chunks absorbed so far. Hasher must not be used after that.
+  constexpr void digest(std::span<uint8_t, DIGEST_BYTE_LEN> out)
+  {
+    hasher.finalize();
+    if constexpr ((hash == hash_t::shake128) || (hash == hash_t::shake256)) {
+      hasher.squeeze(out);
+    } else {
+      hasher.digest(out);
+    }
+  }
+};
+
+// Given a message, this routine computes its digest, using given pre-hash function, in one go.
+template<hash_t hash>
+static inline constexpr void
+digest(std::span<const uint8_t> msg, std::span<uint8_t, DIGEST_BYTE_LEN<hash>> out)
+{
+  prehasher_t<hash> prehasher;
+  prehasher.absorb(msg);
+  prehasher.digest(out);
+}
+
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include "ml_dsa/internals/ml_dsa.hpp"
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// Memory-mappable images of prepared ML-DSA keys
+//
+// An image is a 64 -bytes `header_t`, followed by the prepared public or secret key, laid out exactly as it lives in
+// memory i.e. matrix A, t1 x 2^d ( or s1, s2, t0 ) in NTT domain, as 32 -bit canonical coefficients ( or 23 -bit
+// packed ones, for matrix A of packed prepared public key ), followed by tr ( and K ). As prepared keys are cache-line
+// aligned and consist of cache-line aligned members, a page-aligned image ( say, a memory-mapped file ) can be used in
+// place, without parsing or copying, so that a restarted verifier or signer page-faults in precomputed keys, instead of
+// expanding them again.
+//
+// Images are meant to be produced and consumed on the same kind of host: header records byte order and coefficient
+// representation of the producer, and `view` rejects any image not matching those of the consumer. Coefficients are not
+// validated, so an image must be as trusted as the key it was prepared from. Secret key images hold secret key material
+// and must be protected accordingly.
+namespace ml_dsa_image {
+
+// Magic bytes, an image starts with.
+static constexpr std::array<char, 8> MAGIC = { 'M', 'L', 'D', 'S', 'A', 'I', 'M', 'G' };
+
+// Version of image format, to be bumped on any change to layout of header or prepared keys.
+static constexpr uint32_t VERSION = 1;
+
+// Value of `header_t::byte_order`, as written by the host producing the image.
+static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304u;
+
+enum class kind_t : uint32_t
+{
+  prepared_pubkey = 1,
+  prepared_seckey = 2,
+  packed_prepared_pubkey = 3,
+};
+
+struct alignas(64) header_t
+{
+  std::array<char, 8> magic;
+  uint32_t version;
+  kind_t kind;
+  uint32_t param_set;      // 44, 65 or 87, see `ml_dsa_probes::PARAM_SET`
+  uint32_t byte_order;     // BYTE_ORDER_MARK, in byte order of producer
+  uint32_t coeff_byte_len; // Byte length of a coefficient of Z_q
+  uint32_t q;              // Modulus of Z_q
+  uint64_t body_byte_len;  // Byte length of prepared key, following the header
+  std::array<uint8_t, 24> reserved;
+};
+
+static_assert(sizeof(header_t) == 64);
+
+// Properties of each kind of prepared key, which can be imaged.
+template<typename prepared_t>
+struct traits_t;
+
+template<size_t k, size_t l, bool packed>
+struct traits_t<ml_dsa::prepared_pubkey_t<k, l, packed>>
+{
+  using prepared_t = ml_dsa::prepared_pubkey_t<k, l, packed>;
+
+  static constexpr kind_t KIND = packed ? kind_t::packed_prepared_pubkey : kind_t::prepared_pubkey;
+  static constexpr uint32_t PARAM_SET = ml_dsa_probes::PARAM_SET<k, l>;
+
+  // Byte length of members, excluding trailing padding, if any.
+  static constexpr size_t PAYLOAD_BYTE_LEN = offsetof(prepared_t, tr) + sizeof(prepared_t::tr);
+};
+
+template<size_t k, size_t l>
+struct traits_t<ml_dsa::prepared_seckey_t<k, l>>
+{
+  using prepared_t = ml_dsa::prepared_seckey_t<k, l>;
+
+  static constexpr kind_t KIND = kind_t::prepared_seckey;
+  static constexpr uint32_t PARAM_SET = ml_dsa_probes::PARAM_SET<k, l>;
+
+  // Byte length of members, excluding trailing padding, if any.
+  static constexpr size_t PAYLOAD_BYTE_LEN = offsetof(prepared_t, key) + sizeof(prepared_t::key);
+};
+
+// Byte length of image of a prepared key.
+template<typename prepared_t>
+static constexpr size_t IMAGE_BYTE_LEN = sizeof(header_t) + sizeof(prepared_t);
+
+// Returns header, an image of given kind of prepared key starts with.
+template<typename prepared_t>
+static inline constexpr header_t
+make_header()
+{
+  static_assert(std::is_trivially_copyable_v<prepared_t> && std::is_standard_layout_v<prepared_t>);
+  static_assert(alignof(prepared_t) == sizeof(header_t));
+
+  return header_t{
+    .magic = MAGIC,
+    .version = VERSION,
+    .kind = traits_t<prepared_t>::KIND,
+    .param_set = traits_t<prepared_t>::PARAM_SET,
+    .byte_order = BYTE_ORDER_MARK,
+    .coeff_byte_len = sizeof(ml_dsa_field::zq_t),
+    .q = ml_dsa_field::Q,
+    .body_byte_len = sizeof(prepared_t),
+    .reserved = {},
+  };
+}
+
+// Given a prepared key, this routine writes its image, zeroing trailing padding of the prepared key, if any.
+template<typename prepared_t>
+static inline void
+write(const prepared_t& prepared, std::span<uint8_t, IMAGE_BYTE_LEN<prepared_t>> image)
+{
+  constexpr header_t header = make_header<prepared_t>();
+  constexpr size_t payload_len = traits_t<prepared_t>::PAYLOAD_BYTE_LEN;
+
+  auto body = image.template last<sizeof(prepared_t)>();
+
+  std::memcpy(image.data(), &header, sizeof(header));
+  std::memcpy(body.data(), &prepared, payload_len);
+  std::fill(body.begin() + payload_len, body.end(), 0);
+}
+
+// Given an image, this routine returns pointer to the prepared key it holds, which points into the image itself, if
+// the image is of expected kind, parameter set, version and representation, while being suitably aligned. Otherwise
+// returns nullptr. Only the header is inspected, so this is cheap enough to be used on a freshly mapped file.
+template<typename prepared_t>
+static inline const prepared_t*
+view(std::span<const uint8_t> image)
+{
+  if (image.size() != IMAGE_BYTE_LEN<prepared_t>) {
+    return nullptr;
+  }
+  if (reinterpret_cast<uintptr_t>(image.data()) % alignof(prepared_t) != 0) {
+    return nullptr;
+  }
+
+  constexpr header_t expected = make_header<prepared_t>();
+  if (std::memcmp(image.data(), &expected, sizeof(expected)) != 0) {
+    return nullptr;
+  }
+
+  return reinterpret_cast<const prepared_t*>(image.data() + sizeof(header_t));
+}
+
+}
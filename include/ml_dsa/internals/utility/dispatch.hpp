@@ -0,0 +1,149 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+#include <type_traits>
+
+// Runtime CPU feature detection and kernel dispatch
+//
+// Heavy kernels ( NTT, pointwise polynomial arithmetic, sampling, which includes Keccak permutation, and bit packing )
+// are compiled multiple times, once for each backend, using `target` function attribute, so that a single binary, built
+// without `-march=native`, still uses AVX2 or AVX512 instructions, when the CPU it runs on supports them. Backend is
+// selected once, during first invocation, based on CPUID.
+//
+// Environment variable `ML_DSA_BACKEND` ( one of "scalar", "avx2" or "avx512" ) or `force_backend` routine can be used
+// for forcing a specific backend, which is useful for benchmarking.
+namespace ml_dsa_dispatch {
+
+// Kernel implementations, in increasing order of required CPU features.
+enum class backend_t : uint8_t
+{
+  scalar = 0, // Compiled for the baseline target, as specified by compiler flags
+  avx2 = 1,   // Compiled for x86-64 CPUs supporting AVX2
+  avx512 = 2, // Compiled for x86-64 CPUs supporting AVX512-{F, BW, VBMI}
+};
+
+#if (defined __x86_64__) && (defined __GNUC__)
+#define ML_DSA_DISPATCH_X86_64
+#endif
+
+// Returns the best backend, supported by the CPU, this program is running on.
+static inline backend_t
+detect_backend()
+{
+#if defined ML_DSA_DISPATCH_X86_64
+  __builtin_cpu_init();
+
+  const bool has_avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vbmi");
+  if (has_avx512) {
+    return backend_t::avx512;
+  }
+
+  if (__builtin_cpu_supports("avx2")) {
+    return backend_t::avx2;
+  }
+#endif
+
+  return backend_t::scalar;
+}
+
+// Returns backend requested using `ML_DSA_BACKEND` environment variable, if it's supported by the CPU, otherwise falls
+// back to the best supported backend.
+static inline backend_t
+initial_backend()
+{
+  const backend_t best = detect_backend();
+
+  const char* const env = std::getenv("ML_DSA_BACKEND");
+  if (env == nullptr) {
+    return best;
+  }
+
+  const std::string_view requested(env);
+  backend_t backend = best;
+
+  if (requested == "scalar") {
+    backend = backend_t::scalar;
+  } else if (requested == "avx2") {
+    backend = backend_t::avx2;
+  } else if (requested == "avx512") {
+    backend = backend_t::avx512;
+  }
+
+  return (backend <= best) ? backend : best;
+}
+
+// Holds active backend, shared by all translation units. Initialized during first invocation.
+inline std::atomic<backend_t>&
+backend_state()
+{
+  static std::atomic<backend_t> state{ initial_backend() };
+  return state;
+}
+
+// Returns backend, used for dispatching kernels.
+static inline backend_t
+active_backend()
+{
+  return backend_state().load(std::memory_order_relaxed);
+}
+
+// Forces kernels to be dispatched to a specific backend, returning boolean truth value, only when requested backend
+// is supported by the CPU, otherwise active backend stays unchanged.
+static inline bool
+force_backend(const backend_t backend)
+{
+  if (backend > detect_backend()) {
+    return false;
+  }
+
+  backend_state().store(backend, std::memory_order_relaxed);
+  return true;
+}
+
+#if defined ML_DSA_DISPATCH_X86_64
+
+// Invokes `fn`, with all of its callees inlined into a clone, which is compiled for AVX2 target.
+template<typename fn_t>
+__attribute__((target("avx2,bmi2,fma"), flatten)) static inline void
+run_avx2(const fn_t& fn)
+{
+  fn();
+}
+
+// Invokes `fn`, with all of its callees inlined into a clone, which is compiled for AVX512 target.
+template<typename fn_t>
+__attribute__((target("avx2,bmi2,fma,avx512f,avx512bw,avx512dq,avx512vl,avx512vbmi"), flatten)) static inline void
+run_avx512(const fn_t& fn)
+{
+  fn();
+}
+
+#endif
+
+// Given a kernel, wrapped in a callable ( which takes no argument ), this routine invokes version of the kernel,
+// compiled for the active backend. During constant evaluation, kernel is simply invoked.
+template<typename fn_t>
+static inline constexpr void
+run(const fn_t& fn)
+{
+#if defined ML_DSA_DISPATCH_X86_64
+  if (!std::is_constant_evaluated()) {
+    switch (active_backend()) {
+      case backend_t::avx512:
+        run_avx512(fn);
+        return;
+      case backend_t::avx2:
+        run_avx2(fn);
+        return;
+      default:
+        break;
+    }
+  }
+#endif
+
+  fn();
+}
+
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#if (defined __x86_64__) && (defined __GNUC__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// Per-stage instrumentation of ML-DSA keygen, sign and verify
+//
+// When compiled with `-DML_DSA_INSTRUMENT`, each stage of keygen, sign and verify ( matrix expansion, secret key
+// decoding, mask expansion, NTT/ iNTT, matrix-vector multiplication, hashing, norm checks, hint computation and bit
+// packing ) is timed using time-stamp counter, and the signing procedure counts iterations of its rejection sampling
+// loop, along with the bound which caused each rejection. Statistics are accumulated into a thread-local `stats_t`,
+// which can be read using `stats()` and exported, by the caller. By default, instrumentation is disabled and all of
+// following hooks compile to nothing.
+namespace ml_dsa_instrument {
+
+#if defined ML_DSA_INSTRUMENT
+static constexpr bool ENABLED = true;
+#else
+static constexpr bool ENABLED = false;
+#endif
+
+// Stages of ML-DSA keygen, sign and verify, CPU cycles are attributed to.
+enum class stage_t : uint8_t
+{
+  expand_a,        // Sampling public matrix A from seed ρ
+  expand_s,        // Sampling secret vectors s1, s2 from seed ρ'
+  decode_seckey,   // Decoding s1, s2, t0 from secret key and moving them to NTT domain
+  expand_mask,     // Sampling masking vector y
+  sample_in_ball,  // Sampling challenge polynomial c
+  ntt,             // Forward/ inverse NTT
+  matrix_multiply, // Matrix-vector and polynomial-vector multiplication
+  hashing,         // Computing tr, μ, ρ' and c~, using SHAKE256
+  norm_check,      // Infinity norm computation and hint weight checks
+  hint,            // Power2Round, decomposition, making and using hints
+  packing,         // Encoding and decoding keys and signatures
+};
+
+static constexpr size_t STAGE_CNT = static_cast<size_t>(stage_t::packing) + 1;
+
+// Bounds checked by the rejection sampling loop of the signing procedure, one of which causes each rejection.
+enum class rejection_t : uint8_t
+{
+  z_norm,      // ||z||∞ >= γ1 - β
+  r0_norm,     // ||LowBits(w - cs2)||∞ >= γ2 - β
+  ct0_norm,    // ||ct0||∞ >= γ2
+  hint_weight, // Number of 1s in hint > ω
+};
+
+static constexpr size_t REJECTION_CNT = static_cast<size_t>(rejection_t::hint_weight) + 1;
+
+// Top-level ML-DSA routines, invocations of which are counted.
+enum class op_t : uint8_t
+{
+  keygen,
+  sign,
+  verify,
+};
+
+static constexpr size_t OP_CNT = static_cast<size_t>(op_t::verify) + 1;
+
+// Statistics, accumulated by a single thread.
+struct stats_t
+{
+  std::array<uint64_t, OP_CNT> calls{};             // Number of invocations of each top-level routine
+  std::array<uint64_t, STAGE_CNT> cycles{};         // Time-stamp counter ticks spent in each stage
+  std::array<uint64_t, STAGE_CNT> stage_calls{};    // Number of times each stage was entered
+  std::array<uint64_t, REJECTION_CNT> rejections{}; // Number of rejections, caused by each bound
+  uint64_t sign_iterations = 0;                     // Iterations of the rejection sampling loop, over all signing calls
+
+  // Adds statistics of another thread to this one, useful for aggregating statistics of many threads.
+  stats_t& operator+=(const stats_t& other)
+  {
+    for (size_t i = 0; i < OP_CNT; i++) {
+      calls[i] += other.calls[i];
+    }
+    for (size_t i = 0; i < STAGE_CNT; i++) {
+      cycles[i] += other.cycles[i];
+      stage_calls[i] += other.stage_calls[i];
+    }
+    for (size_t i = 0; i < REJECTION_CNT; i++) {
+      rejections[i] += other.rejections[i];
+    }
+    sign_iterations += other.sign_iterations;
+
+    return *this;
+  }
+};
+
+// Returns human readable name of a stage, for exporting statistics.
+static inline constexpr std::string_view
+stage_name(const stage_t stage)
+{
+  constexpr std::array<std::string_view, STAGE_CNT> names = {
+    "expand_a", "expand_s", "decode_seckey", "expand_mask", "sample_in_ball", "ntt", "matrix_multiply", "hashing", "norm_check", "hint", "packing",
+  };
+  return names[static_cast<size_t>(stage)];
+}
+
+// Returns human readable name of a rejection reason, for exporting statistics.
+static inline constexpr std::string_view
+rejection_name(const rejection_t rejection)
+{
+  constexpr std::array<std::string_view, REJECTION_CNT> names = { "z_norm", "r0_norm", "ct0_norm", "hint_weight" };
+  return names[static_cast<size_t>(rejection)];
+}
+
+// Returns statistics, accumulated by the calling thread.
+inline stats_t&
+stats()
+{
+  thread_local stats_t state{};
+  return state;
+}
+
+// Clears statistics, accumulated by the calling thread.
+static inline void
+reset_stats()
+{
+  stats() = stats_t{};
+}
+
+// Returns current value of time-stamp counter, or of a monotonic clock in nanoseconds, on non-x86-64 targets.
+static inline uint64_t
+timestamp()
+{
+#if (defined __x86_64__) && (defined __GNUC__)
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Invokes `fn` ( which takes no argument ), attributing time spent in it to given stage, when instrumentation is
+// enabled and not being constant evaluated. Otherwise `fn` is simply invoked.
+template<stage_t stage, typename fn_t>
+static inline constexpr void
+measure(const fn_t& fn)
+{
+  if constexpr (ENABLED) {
+    if (!std::is_constant_evaluated()) {
+      const uint64_t t0 = timestamp();
+      fn();
+      const uint64_t t1 = timestamp();
+
+      auto& s = stats();
+      s.cycles[static_cast<size_t>(stage)] += t1 - t0;
+      s.stage_calls[static_cast<size_t>(stage)]++;
+      return;
+    }
+  }
+
+  fn();
+}
+
+// Counts an invocation of a top-level routine.
+static inline constexpr void
+record_call(const op_t op)
+{
+  if constexpr (ENABLED) {
+    if (!std::is_constant_evaluated()) {
+      stats().calls[static_cast<size_t>(op)]++;
+    }
+  }
+}
+
+// Counts an iteration of the rejection sampling loop of the signing procedure.
+static inline constexpr void
+record_iteration()
+{
+  if constexpr (ENABLED) {
+    if (!std::is_constant_evaluated()) {
+      stats().sign_iterations++;
+    }
+  }
+}
+
+// Counts a rejection of a signing attempt, caused by given bound.
+static inline constexpr void
+record_rejection(const rejection_t rejection)
+{
+  if constexpr (ENABLED) {
+    if (!std::is_constant_evaluated()) {
+      stats().rejections[static_cast<size_t>(rejection)]++;
+    }
+  }
+}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Linux USDT ( user-level statically defined tracing ) probes
+//
+// When compiled with `-DML_DSA_USDT`, on a system providing <sys/sdt.h> ( e.g. systemtap-sdt-dev package on Debian,
+// systemtap-sdt-devel on Fedora ), keygen, sign and verify fire USDT probes of provider `ml_dsa`, which tools like
+// bpftrace, perf and SystemTap can attach to, giving stable points to trace, in spite of all routines being inlined
+// templates. A probe site, which nobody is attached to, is a single NOP instruction. By default, probes aren't compiled
+// in at all.
+//
+// Probe                  | Arguments
+// ---                    | ---
+// keygen__entry          | param set
+// keygen__return         | param set
+// prepare_seckey__entry  | param set
+// prepare_seckey__return | param set
+// prepare_pubkey__entry  | param set
+// prepare_pubkey__return | param set
+// sign__entry            | param set, message length
+// sign__reject           | param set, κ ( l x index of rejected iteration, as in FIPS 204 ), reason ( see `ml_dsa_instrument::rejection_t` )
+// sign__return           | param set, message length, number of iterations of rejection sampling loop
+// verify__entry          | param set, message length
+// verify__return         | param set, message length, 1 if signature is valid, otherwise 0
+//
+// Verifying with a public key first prepares it, so verify__* probes only cover verification of the signature. Message
+// length is reported as 0, when signing or verifying with message representative μ.
+//
+// Parameter set is passed as 44, 65 or 87, for ML-DSA-44, ML-DSA-65 and ML-DSA-87, respectively. For example
+//
+// $ bpftrace -e 'usdt:./a.out:ml_dsa:sign__reject { @reasons[arg0, arg2] = count(); }'
+namespace ml_dsa_probes {
+
+// Identifier of a ML-DSA parameter set, passed as first argument of each probe, which happens to be k x 10 + l.
+template<size_t k, size_t l>
+static constexpr uint32_t PARAM_SET = static_cast<uint32_t>(k * 10 + l);
+
+}
+
+#if defined ML_DSA_USDT
+
+#if !__has_include(<sys/sdt.h>)
+#error "ML_DSA_USDT requires <sys/sdt.h>, install systemtap-sdt-dev(el) package"
+#endif
+
+#include <sys/sdt.h>
+
+// Fires USDT probe `name` of provider `ml_dsa`, unless being constant evaluated.
+#define ML_DSA_PROBE(name, ...)                                                                                                                                \
+  do {                                                                                                                                                         \
+    if (!std::is_constant_evaluated()) {                                                                                                                       \
+      STAP_PROBEV(ml_dsa, name, __VA_ARGS__);                                                                                                                  \
+    }                                                                                                                                                          \
+  } while (0)
+
+#else
+
+// Probes are not compiled in, arguments are not even evaluated.
+#define ML_DSA_PROBE(name, ...)                                                                                                                                \
+  do {                                                                                                                                                         \
+  } while (0)
+
+#endif
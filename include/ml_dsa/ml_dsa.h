@@ -0,0 +1,137 @@
+#ifndef ML_DSA_H
+#define ML_DSA_H
+
+// C ABI of precompiled ML-DSA library `libmldsa.{so,a}`, built using `make lib`.
+//
+// All three ML-DSA parameter sets are instantiated once, inside the library, on top of runtime parameter set selection
+// API ( see include/ml_dsa/ml_dsa_runtime.hpp ), so that C, or any other language with a C FFI, can call into a single
+// optimized copy of ML-DSA routines. Unless otherwise stated, routines return ML_DSA_OK on success, otherwise one of
+// negative error codes, in which case output buffers are left untouched.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__GNUC__)
+#define ML_DSA_API __attribute__((visibility("default")))
+#else
+#define ML_DSA_API
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  // ML-DSA parameter sets, as specified in table 1 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd
+  typedef enum ml_dsa_param_set
+  {
+    ML_DSA_44 = 0,
+    ML_DSA_65 = 1,
+    ML_DSA_87 = 2,
+  } ml_dsa_param_set_t;
+
+  // Status codes returned by ML-DSA routines.
+  enum
+  {
+    ML_DSA_OK = 0,
+    ML_DSA_ERR_PARAM_SET = -1,         // Unknown parameter set
+    ML_DSA_ERR_LENGTH = -2,            // Byte length of key or signature doesn't match the parameter set
+    ML_DSA_ERR_INVALID_SIGNATURE = -3, // Signature verification failed
+    ML_DSA_ERR_ALLOC = -4,             // Memory allocation failed
+  };
+
+  // Byte length of key generation seed and signing seed, same for all parameter sets.
+#define ML_DSA_KEYGEN_SEED_BYTE_LEN 32
+#define ML_DSA_SIGNING_SEED_BYTE_LEN 32
+
+  // Byte lengths of public key, secret key and signature of a parameter set. Returns 0 for unknown parameter set.
+  ML_DSA_API size_t ml_dsa_pubkey_byte_len(ml_dsa_param_set_t param_set);
+  ML_DSA_API size_t ml_dsa_seckey_byte_len(ml_dsa_param_set_t param_set);
+  ML_DSA_API size_t ml_dsa_sig_byte_len(ml_dsa_param_set_t param_set);
+
+  // Given a 32 -bytes seed, generates a fresh keypair of requested parameter set.
+  ML_DSA_API int ml_dsa_keygen(ml_dsa_param_set_t param_set,
+                               const uint8_t seed[ML_DSA_KEYGEN_SEED_BYTE_LEN],
+                               uint8_t* pubkey,
+                               size_t pubkey_len,
+                               uint8_t* seckey,
+                               size_t seckey_len);
+
+  // Given a 32 -bytes seed `rnd` and a secret key, signs message of `msg_len` -bytes. Fill `rnd` with zero bytes for
+  // deterministic signing.
+  ML_DSA_API int ml_dsa_sign(ml_dsa_param_set_t param_set,
+                             const uint8_t rnd[ML_DSA_SIGNING_SEED_BYTE_LEN],
+                             const uint8_t* seckey,
+                             size_t seckey_len,
+                             const uint8_t* msg,
+                             size_t msg_len,
+                             uint8_t* sig,
+                             size_t sig_len);
+
+  // Verifies signature over message using public key, returning ML_DSA_OK only if signature is valid.
+  ML_DSA_API int ml_dsa_verify(ml_dsa_param_set_t param_set,
+                               const uint8_t* pubkey,
+                               size_t pubkey_len,
+                               const uint8_t* msg,
+                               size_t msg_len,
+                               const uint8_t* sig,
+                               size_t sig_len);
+
+  // Opaque secret key, expanded into the form consumed by the signing procedure. Useful when many messages are to be
+  // signed using the same secret key.
+  typedef struct ml_dsa_prepared_seckey ml_dsa_prepared_seckey_t;
+
+  // Expands a secret key into a freshly allocated prepared secret key, which must be released using
+  // `ml_dsa_prepared_seckey_free`. Returns NULL, writing reason to `status` ( if non-NULL ), on failure.
+  ML_DSA_API ml_dsa_prepared_seckey_t* ml_dsa_prepare_seckey(ml_dsa_param_set_t param_set, const uint8_t* seckey, size_t seckey_len, int* status);
+
+  // Releases a prepared secret key, wiping it first. Accepts NULL.
+  ML_DSA_API void ml_dsa_prepared_seckey_free(ml_dsa_prepared_seckey_t* prepared);
+
+  // Signs message using a prepared secret key, producing the same signature as `ml_dsa_sign` with the secret key.
+  ML_DSA_API int ml_dsa_sign_prepared(const ml_dsa_prepared_seckey_t* prepared,
+                                      const uint8_t rnd[ML_DSA_SIGNING_SEED_BYTE_LEN],
+                                      const uint8_t* msg,
+                                      size_t msg_len,
+                                      uint8_t* sig,
+                                      size_t sig_len);
+
+  // A signing request, as consumed by `ml_dsa_sign_batch`.
+  typedef struct ml_dsa_sign_request
+  {
+    ml_dsa_param_set_t param_set;
+    const uint8_t* rnd; // ML_DSA_SIGNING_SEED_BYTE_LEN -bytes
+    const uint8_t* seckey;
+    size_t seckey_len;
+    const uint8_t* msg;
+    size_t msg_len;
+    uint8_t* sig;
+    size_t sig_len;
+  } ml_dsa_sign_request_t;
+
+  // A verification request, as consumed by `ml_dsa_verify_batch`.
+  typedef struct ml_dsa_verify_request
+  {
+    ml_dsa_param_set_t param_set;
+    const uint8_t* pubkey;
+    size_t pubkey_len;
+    const uint8_t* msg;
+    size_t msg_len;
+    const uint8_t* sig;
+    size_t sig_len;
+  } ml_dsa_verify_request_t;
+
+  // Signs n requests, possibly of different parameter sets, writing status of i-th request to `status[i]`. Requests are
+  // grouped by parameter set, and consecutive requests signed by the same secret key share the expanded secret key.
+  // Returns ML_DSA_OK if all requests were signed, otherwise status of the first failed request.
+  ML_DSA_API int ml_dsa_sign_batch(const ml_dsa_sign_request_t* reqs, size_t n, int* status);
+
+  // Verifies n requests, possibly of different parameter sets, writing status of i-th request to `status[i]`. Returns
+  // ML_DSA_OK if all signatures are valid, otherwise status of the first failed request.
+  ML_DSA_API int ml_dsa_verify_batch(const ml_dsa_verify_request_t* reqs, size_t n, int* status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
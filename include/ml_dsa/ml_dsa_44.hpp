@@ -1,5 +1,7 @@
 #pragma once
 #include "ml_dsa/internals/ml_dsa.hpp"
+#include "ml_dsa/internals/prepared_image.hpp"
+#include "ml_dsa/internals/utility/dispatch.hpp"
 
 namespace ml_dsa_44 {
 
@@ -30,11 +32,17 @@ static constexpr size_t SigningSeedByteLen = ml_dsa::RND_BYTE_LEN;
 // Byte length ( = 2420 ) of ML-DSA-44 signature.
 static constexpr size_t SigByteLen = ml_dsa_utils::sig_len(k, l, γ1, ω, λ);
 
+// Byte length ( = 64 ) of message representative μ, see `sign_mu`.
+static constexpr size_t MuByteLen = ml_dsa::MU_BYTE_LEN;
+
+// Maximum byte length ( = 255 ) of context string, a signature can be bound to, see `sign` and `sign_prehash`.
+static constexpr size_t MaxCtxByteLen = ml_dsa::MAX_CTX_BYTE_LEN;
+
 // Given a 32 -bytes seed, this routine can be used for generating a fresh ML-DSA-44 keypair.
 constexpr void
 keygen(std::span<const uint8_t, KeygenSeedByteLen> ξ, std::span<uint8_t, PubKeyByteLen> pubkey, std::span<uint8_t, SecKeyByteLen> seckey)
 {
-  ml_dsa::keygen<k, l, d, η>(ξ, pubkey, seckey);
+  ml_dsa_dispatch::run([&]() { ml_dsa::keygen<k, l, d, η>(ξ, pubkey, seckey); });
 }
 
 // Given a 32 -bytes seed `rnd` and ML-DSA-44 secret key, this routine can be used for signing any arbitrary (>=0)
@@ -45,7 +53,113 @@ keygen(std::span<const uint8_t, KeygenSeedByteLen> ξ, std::span<uint8_t, PubKey
 constexpr void
 sign(std::span<const uint8_t, SigningSeedByteLen> rnd, std::span<const uint8_t, SecKeyByteLen> seckey, std::span<const uint8_t> msg, std::span<uint8_t, SigByteLen> sig)
 {
-  ml_dsa::sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, seckey, msg, sig);
+  ml_dsa_dispatch::run([&]() { ml_dsa::sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, seckey, msg, sig); });
+}
+
+// Given a 32 -bytes seed `rnd`, ML-DSA-44 secret key, context string ( of at most 255 -bytes, can be empty, say a protocol
+// name ) and a message M, this routine produces a ML-DSA-44 signature S, bound to the context string, which only verifies
+// under the very same context string. Context string and message are hashed right from where they are, without being
+// copied together. Returns false, without signing, if context string is too long.
+constexpr bool
+sign(std::span<const uint8_t, SigningSeedByteLen> rnd,
+     std::span<const uint8_t, SecKeyByteLen> seckey,
+     std::span<const uint8_t> ctx,
+     std::span<const uint8_t> msg,
+     std::span<uint8_t, SigByteLen> sig)
+{
+  bool is_signed = false;
+  ml_dsa_dispatch::run([&]() { is_signed = ml_dsa::sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, seckey, ctx, msg, sig); });
+  return is_signed;
+}
+
+// Given a 32 -bytes seed `rnd`, ML-DSA-44 secret key, context string ( of at most 255 -bytes, can be empty ), a pre-hash
+// function and digest of message M, computed using that function ( see `ml_dsa_prehash::prehasher_t`, which digests a
+// message of any length, in streaming fashion ), this routine produces a HashML-DSA signature S over the digest.
+// Returns false, without signing, if context string is too long or digest length doesn't match the pre-hash function.
+constexpr bool
+sign_prehash(std::span<const uint8_t, SigningSeedByteLen> rnd,
+             std::span<const uint8_t, SecKeyByteLen> seckey,
+             std::span<const uint8_t> ctx,
+             const ml_dsa_prehash::hash_t hash,
+             std::span<const uint8_t> digest,
+             std::span<uint8_t, SigByteLen> sig)
+{
+  bool is_signed = false;
+  ml_dsa_dispatch::run([&]() { is_signed = ml_dsa::sign_prehash<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, seckey, ctx, hash, digest, sig); });
+  return is_signed;
+}
+
+// ML-DSA-44 secret key, expanded into the form consumed by the signing procedure. Useful when many messages are to be
+// signed using the same secret key.
+using prepared_seckey_t = ml_dsa::prepared_seckey_t<k, l>;
+
+// Given a ML-DSA-44 secret key, this routine expands it into a prepared secret key, which can be used for signing.
+constexpr void
+prepare_seckey(std::span<const uint8_t, SecKeyByteLen> seckey, prepared_seckey_t& prepared)
+{
+  ml_dsa_dispatch::run([&]() { ml_dsa::prepare_seckey<k, l, d, η>(seckey, prepared); });
+}
+
+// Given a 32 -bytes seed `rnd` and prepared ML-DSA-44 secret key, this routine can be used for signing any arbitrary
+// (>=0) length message M, producing a ML-DSA-44 signature S, same as the one produced by signing with the secret key.
+constexpr void
+sign(std::span<const uint8_t, SigningSeedByteLen> rnd, const prepared_seckey_t& prepared, std::span<const uint8_t> msg, std::span<uint8_t, SigByteLen> sig)
+{
+  ml_dsa_dispatch::run([&]() { ml_dsa::sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, msg, sig); });
+}
+
+// Given a 32 -bytes seed `rnd`, prepared ML-DSA-44 secret key, SHAKE256 state after absorbing public key hash tr and
+// a message prefix ( see `ml_dsa::absorb_prefix` ) and rest of the message, this routine signs prefix || suffix, same
+// as `sign` does, absorbing only the suffix. Returns false, without signing, if the state was computed for another key.
+constexpr bool
+sign(std::span<const uint8_t, SigningSeedByteLen> rnd,
+     const prepared_seckey_t& prepared,
+     const ml_dsa::mu_prefix_t& state,
+     std::span<const uint8_t> suffix,
+     std::span<uint8_t, SigByteLen> sig)
+{
+  bool is_signed = false;
+  ml_dsa_dispatch::run([&]() { is_signed = ml_dsa::sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, state, suffix, sig); });
+  return is_signed;
+}
+
+// Given a 32 -bytes seed `rnd`, prepared ML-DSA-44 secret key, context string and a message M, this routine produces a
+// signature S, bound to the context string, same as `sign` taking the secret key and a context string does.
+constexpr bool
+sign(std::span<const uint8_t, SigningSeedByteLen> rnd,
+     const prepared_seckey_t& prepared,
+     std::span<const uint8_t> ctx,
+     std::span<const uint8_t> msg,
+     std::span<uint8_t, SigByteLen> sig)
+{
+  bool is_signed = false;
+  ml_dsa_dispatch::run([&]() { is_signed = ml_dsa::sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, ctx, msg, sig); });
+  return is_signed;
+}
+
+// Given a 32 -bytes seed `rnd`, prepared ML-DSA-44 secret key, context string, a pre-hash function and digest of message
+// M, this routine produces a HashML-DSA signature S, same as `sign_prehash` taking the secret key does.
+constexpr bool
+sign_prehash(std::span<const uint8_t, SigningSeedByteLen> rnd,
+             const prepared_seckey_t& prepared,
+             std::span<const uint8_t> ctx,
+             const ml_dsa_prehash::hash_t hash,
+             std::span<const uint8_t> digest,
+             std::span<uint8_t, SigByteLen> sig)
+{
+  bool is_signed = false;
+  ml_dsa_dispatch::run([&]() { is_signed = ml_dsa::sign_prehash<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, ctx, hash, digest, sig); });
+  return is_signed;
+}
+
+// Given a 32 -bytes seed `rnd`, prepared ML-DSA-44 secret key and 64 -bytes message representative μ = H(tr || M, 64),
+// where tr is the 64 -bytes public key hash ( also found in the secret key, see `prepared_seckey_t::tr` ), this routine
+// produces a ML-DSA-44 signature over message M, same as `sign` does. It lets a party, which doesn't hold the secret
+// key, hash the message. Use `ml_dsa::compute_mu` for computing μ.
+constexpr void
+sign_mu(std::span<const uint8_t, SigningSeedByteLen> rnd, const prepared_seckey_t& prepared, std::span<const uint8_t, MuByteLen> mu, std::span<uint8_t, SigByteLen> sig)
+{
+  ml_dsa_dispatch::run([&]() { ml_dsa::sign_mu<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, prepared, mu, sig); });
 }
 
 // Given a ML-DSA-44 public key, a message M and a signature S, this routine can be used for verifying if the signature
@@ -54,7 +168,266 @@ sign(std::span<const uint8_t, SigningSeedByteLen> rnd, std::span<const uint8_t,
 constexpr bool
 verify(std::span<const uint8_t, PubKeyByteLen> pubkey, std::span<const uint8_t> msg, std::span<const uint8_t, SigByteLen> sig)
 {
-  return ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(pubkey, msg, sig);
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(pubkey, msg, sig); });
+  return is_valid;
+}
+
+// Given a ML-DSA-44 public key, context string, a message M and a signature S, this routine verifies the signature, bound
+// to the context string, returning truth value only in case of successful signature verification, otherwise false is
+// returned.
+constexpr bool
+verify(std::span<const uint8_t, PubKeyByteLen> pubkey, std::span<const uint8_t> ctx, std::span<const uint8_t> msg, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(pubkey, ctx, msg, sig); });
+  return is_valid;
+}
+
+// Given a ML-DSA-44 public key, context string, a pre-hash function, digest of message M, computed using that function,
+// and a HashML-DSA signature S, this routine verifies the signature over the digest, returning truth value only in
+// case of successful signature verification, otherwise false is returned.
+constexpr bool
+verify_prehash(std::span<const uint8_t, PubKeyByteLen> pubkey,
+               std::span<const uint8_t> ctx,
+               const ml_dsa_prehash::hash_t hash,
+               std::span<const uint8_t> digest,
+               std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify_prehash<k, l, d, γ1, γ2, τ, β, ω, λ>(pubkey, ctx, hash, digest, sig); });
+  return is_valid;
+}
+
+// ML-DSA-44 public key, expanded into the form consumed by the verification procedure. Useful when many signatures
+// are to be verified using the same public key.
+using prepared_pubkey_t = ml_dsa::prepared_pubkey_t<k, l>;
+
+// Given a ML-DSA-44 public key, this routine expands it into a prepared public key, which can be used for verification.
+constexpr void
+prepare_pubkey(std::span<const uint8_t, PubKeyByteLen> pubkey, prepared_pubkey_t& prepared)
+{
+  ml_dsa_dispatch::run([&]() { ml_dsa::prepare_pubkey<k, l, d>(pubkey, prepared); });
+}
+
+// Given a prepared ML-DSA-44 public key, a message M and a signature S, this routine verifies the signature, same as
+// `verify` does, when invoked with the public key, from which prepared key was obtained.
+constexpr bool
+verify(const prepared_pubkey_t& prepared, std::span<const uint8_t> msg, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, msg, sig); });
+  return is_valid;
+}
+
+// Given a prepared ML-DSA-44 public key, 64 -bytes message representative μ = H(tr || M, 64) and a signature S, this
+// routine verifies the signature over message M, same as `verify` does. Use `ml_dsa::compute_mu` for computing μ.
+constexpr bool
+verify_mu(const prepared_pubkey_t& prepared, std::span<const uint8_t, MuByteLen> mu, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify_mu<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, mu, sig); });
+  return is_valid;
+}
+
+// Given a prepared ML-DSA-44 public key, SHAKE256 state after absorbing public key hash tr and a message prefix ( see
+// `ml_dsa::absorb_prefix` ), rest of the message and a signature S, this routine verifies the signature over
+// prefix || suffix, same as `verify` does, absorbing only the suffix.
+constexpr bool
+verify(const prepared_pubkey_t& prepared, const ml_dsa::mu_prefix_t& state, std::span<const uint8_t> suffix, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, state, suffix, sig); });
+  return is_valid;
+}
+
+// Given a prepared ML-DSA-44 public key, context string, a message M and a signature S, this routine verifies the
+// signature, same as `verify` taking the public key and a context string does.
+constexpr bool
+verify(const prepared_pubkey_t& prepared, std::span<const uint8_t> ctx, std::span<const uint8_t> msg, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, ctx, msg, sig); });
+  return is_valid;
+}
+
+// Given a prepared ML-DSA-44 public key, context string, a pre-hash function, digest of message M and a HashML-DSA
+// signature S, this routine verifies the signature, same as `verify_prehash` taking the public key does.
+constexpr bool
+verify_prehash(const prepared_pubkey_t& prepared,
+               std::span<const uint8_t> ctx,
+               const ml_dsa_prehash::hash_t hash,
+               std::span<const uint8_t> digest,
+               std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify_prehash<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, ctx, hash, digest, sig); });
+  return is_valid;
+}
+
+// Prepared ML-DSA-44 public key, with matrix A stored using 23 -bits per coefficient, which is ~28% smaller than
+// `prepared_pubkey_t`, so that more of them fit in memory or cache, at the cost of unpacking A during verification.
+using packed_prepared_pubkey_t = ml_dsa::prepared_pubkey_t<k, l, true>;
+
+// Given a ML-DSA-44 public key, this routine expands it into a packed prepared public key.
+constexpr void
+prepare_pubkey(std::span<const uint8_t, PubKeyByteLen> pubkey, packed_prepared_pubkey_t& prepared)
+{
+  ml_dsa_dispatch::run([&]() { ml_dsa::prepare_pubkey<k, l, d>(pubkey, prepared); });
+}
+
+// Given a packed prepared ML-DSA-44 public key, a message M and a signature S, this routine verifies the signature,
+// same as `verify` does, when invoked with the public key, from which prepared key was obtained.
+constexpr bool
+verify(const packed_prepared_pubkey_t& prepared, std::span<const uint8_t> msg, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, msg, sig); });
+  return is_valid;
+}
+
+// Given a packed prepared ML-DSA-44 public key, 64 -bytes message representative μ = H(tr || M, 64) and a signature
+// S, this routine verifies the signature over message M, same as `verify` does.
+constexpr bool
+verify_mu(const packed_prepared_pubkey_t& prepared, std::span<const uint8_t, MuByteLen> mu, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify_mu<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, mu, sig); });
+  return is_valid;
+}
+
+// Given a packed prepared ML-DSA-44 public key, SHAKE256 state after absorbing public key hash tr and a message
+// prefix ( see `ml_dsa::absorb_prefix` ), rest of the message and a signature S, this routine verifies the signature
+// over prefix || suffix, same as `verify` does, absorbing only the suffix.
+constexpr bool
+verify(const packed_prepared_pubkey_t& prepared, const ml_dsa::mu_prefix_t& state, std::span<const uint8_t> suffix, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, state, suffix, sig); });
+  return is_valid;
+}
+
+// Given a packed prepared ML-DSA-44 public key, context string, a message M and a signature S, this routine verifies the
+// signature, same as `verify` taking the public key and a context string does.
+constexpr bool
+verify(const packed_prepared_pubkey_t& prepared, std::span<const uint8_t> ctx, std::span<const uint8_t> msg, std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, ctx, msg, sig); });
+  return is_valid;
+}
+
+// Given a packed prepared ML-DSA-44 public key, context string, a pre-hash function, digest of message M and a HashML-DSA
+// signature S, this routine verifies the signature, same as `verify_prehash` taking the public key does.
+constexpr bool
+verify_prehash(const packed_prepared_pubkey_t& prepared,
+               std::span<const uint8_t> ctx,
+               const ml_dsa_prehash::hash_t hash,
+               std::span<const uint8_t> digest,
+               std::span<const uint8_t, SigByteLen> sig)
+{
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify_prehash<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, ctx, hash, digest, sig); });
+  return is_valid;
+}
+
+// Given a ML-DSA-44 public key, n messages and n signatures, this routine expands the public key once and verifies
+// i-th signature over i-th message, writing the result to `status[i]`, returning truth value, only if all signatures
+// are valid. Response vectors of several signatures are multiplied by matrix A together, sharing loads of A. Number of
+// messages, signatures and length of `status` must be equal.
+constexpr bool
+verify_many(std::span<const uint8_t, PubKeyByteLen> pubkey,
+            std::span<const std::span<const uint8_t>> msgs,
+            std::span<const std::span<const uint8_t, SigByteLen>> sigs,
+            std::span<bool> status)
+{
+  bool are_all_valid = false;
+  ml_dsa_dispatch::run([&]() { are_all_valid = ml_dsa::verify_many<k, l, d, γ1, γ2, τ, β, ω, λ>(pubkey, msgs, sigs, status); });
+  return are_all_valid;
+}
+
+// Given a prepared ML-DSA-44 public key, n messages and n signatures, this routine verifies i-th signature over i-th
+// message, same as `verify_many` taking a public key does.
+constexpr bool
+verify_many(const prepared_pubkey_t& prepared,
+            std::span<const std::span<const uint8_t>> msgs,
+            std::span<const std::span<const uint8_t, SigByteLen>> sigs,
+            std::span<bool> status)
+{
+  bool are_all_valid = false;
+  ml_dsa_dispatch::run([&]() { are_all_valid = ml_dsa::verify_many<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, msgs, sigs, status); });
+  return are_all_valid;
+}
+
+// Given a packed prepared ML-DSA-44 public key, n messages and n signatures, this routine verifies i-th signature over
+// i-th message, same as `verify_many` taking a public key does, unpacking matrix A once per batch of signatures.
+constexpr bool
+verify_many(const packed_prepared_pubkey_t& prepared,
+            std::span<const std::span<const uint8_t>> msgs,
+            std::span<const std::span<const uint8_t, SigByteLen>> sigs,
+            std::span<bool> status)
+{
+  bool are_all_valid = false;
+  ml_dsa_dispatch::run([&]() { are_all_valid = ml_dsa::verify_many<k, l, d, γ1, γ2, τ, β, ω, λ>(prepared, msgs, sigs, status); });
+  return are_all_valid;
+}
+
+// Byte length of memory-mappable image of a prepared ML-DSA-44 public key, see `ml_dsa_image`.
+static constexpr size_t PreparedPubKeyImageByteLen = ml_dsa_image::IMAGE_BYTE_LEN<prepared_pubkey_t>;
+
+// Byte length of memory-mappable image of a packed prepared ML-DSA-44 public key, see `ml_dsa_image`.
+static constexpr size_t PackedPreparedPubKeyImageByteLen = ml_dsa_image::IMAGE_BYTE_LEN<packed_prepared_pubkey_t>;
+
+// Byte length of memory-mappable image of a prepared ML-DSA-44 secret key, see `ml_dsa_image`.
+static constexpr size_t PreparedSecKeyImageByteLen = ml_dsa_image::IMAGE_BYTE_LEN<prepared_seckey_t>;
+
+// Given a prepared ML-DSA-44 public key, this routine writes its image, which can later be used in place, see
+// `view_prepared_pubkey`.
+inline void
+write_image(const prepared_pubkey_t& prepared, std::span<uint8_t, PreparedPubKeyImageByteLen> image)
+{
+  ml_dsa_image::write(prepared, image);
+}
+
+// Given a packed prepared ML-DSA-44 public key, this routine writes its image, which can later be used in place, see
+// `view_packed_prepared_pubkey`.
+inline void
+write_image(const packed_prepared_pubkey_t& prepared, std::span<uint8_t, PackedPreparedPubKeyImageByteLen> image)
+{
+  ml_dsa_image::write(prepared, image);
+}
+
+// Given a prepared ML-DSA-44 secret key, this routine writes its image, which can later be used in place, see
+// `view_prepared_seckey`.
+inline void
+write_image(const prepared_seckey_t& prepared, std::span<uint8_t, PreparedSecKeyImageByteLen> image)
+{
+  ml_dsa_image::write(prepared, image);
+}
+
+// Given an image, say a memory-mapped file, of a prepared ML-DSA-44 public key, this routine returns pointer to the
+// prepared public key, living inside the image, or nullptr, if it isn't such an image. Image must be 64 -bytes aligned.
+inline const prepared_pubkey_t*
+view_prepared_pubkey(std::span<const uint8_t> image)
+{
+  return ml_dsa_image::view<prepared_pubkey_t>(image);
+}
+
+// Given an image, say a memory-mapped file, of a packed prepared ML-DSA-44 public key, this routine returns pointer
+// to the packed prepared public key, living inside the image, or nullptr, if it isn't such an image. Image must be 64
+// -bytes aligned.
+inline const packed_prepared_pubkey_t*
+view_packed_prepared_pubkey(std::span<const uint8_t> image)
+{
+  return ml_dsa_image::view<packed_prepared_pubkey_t>(image);
+}
+
+// Given an image, say a memory-mapped file, of a prepared ML-DSA-44 secret key, this routine returns pointer to the
+// prepared secret key, living inside the image, or nullptr, if it isn't such an image. Image must be 64 -bytes aligned.
+inline const prepared_seckey_t*
+view_prepared_seckey(std::span<const uint8_t> image)
+{
+  return ml_dsa_image::view<prepared_seckey_t>(image);
 }
 
 }
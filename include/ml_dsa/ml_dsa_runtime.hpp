@@ -0,0 +1,419 @@
+#pragma once
+#include "ml_dsa/ml_dsa_44.hpp"
+#include "ml_dsa/ml_dsa_65.hpp"
+#include "ml_dsa/ml_dsa_87.hpp"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+// Runtime selectable ML-DSA parameter set API
+//
+// Parameter sets are compile-time template arguments of ML-DSA routines, which is great for performance, but services
+// handling ML-DSA-44, ML-DSA-65 and ML-DSA-87 keys in the same process need to pick the parameter set at runtime. This
+// façade maps a `param_set_t` to a table of function pointers, pointing to respective instantiations, which take
+// dynamically sized byte spans and check their lengths. Batch routines group requests by parameter set, so that each
+// group is processed by the same instantiation, compiled for the active backend, reusing prepared secret keys.
+namespace ml_dsa_runtime {
+
+// ML-DSA parameter sets, as specified in table 1 of ML-DSA draft standard @ https://doi.org/10.6028/NIST.FIPS.204.ipd
+enum class param_set_t : uint8_t
+{
+  ml_dsa_44 = 0,
+  ml_dsa_65 = 1,
+  ml_dsa_87 = 2,
+};
+
+// Number of supported parameter sets.
+static constexpr size_t PARAM_SET_CNT = 3;
+
+// Byte length of key generation seed, same for all parameter sets.
+static constexpr size_t KeygenSeedByteLen = ml_dsa::KEYGEN_SEED_BYTE_LEN;
+
+// Byte length of signing seed, same for all parameter sets.
+static constexpr size_t SigningSeedByteLen = ml_dsa::RND_BYTE_LEN;
+
+// Compile-time parameters of each ML-DSA parameter set, used for instantiating routines behind the dispatch table.
+template<param_set_t param_set>
+struct params_t;
+
+template<>
+struct params_t<param_set_t::ml_dsa_44>
+{
+  static constexpr size_t d = ml_dsa_44::d, k = ml_dsa_44::k, l = ml_dsa_44::l, ω = ml_dsa_44::ω, λ = ml_dsa_44::λ;
+  static constexpr uint32_t τ = ml_dsa_44::τ, γ1 = ml_dsa_44::γ1, γ2 = ml_dsa_44::γ2, η = ml_dsa_44::η, β = ml_dsa_44::β;
+};
+
+template<>
+struct params_t<param_set_t::ml_dsa_65>
+{
+  static constexpr size_t d = ml_dsa_65::d, k = ml_dsa_65::k, l = ml_dsa_65::l, ω = ml_dsa_65::ω, λ = ml_dsa_65::λ;
+  static constexpr uint32_t τ = ml_dsa_65::τ, γ1 = ml_dsa_65::γ1, γ2 = ml_dsa_65::γ2, η = ml_dsa_65::η, β = ml_dsa_65::β;
+};
+
+template<>
+struct params_t<param_set_t::ml_dsa_87>
+{
+  static constexpr size_t d = ml_dsa_87::d, k = ml_dsa_87::k, l = ml_dsa_87::l, ω = ml_dsa_87::ω, λ = ml_dsa_87::λ;
+  static constexpr uint32_t τ = ml_dsa_87::τ, γ1 = ml_dsa_87::γ1, γ2 = ml_dsa_87::γ2, η = ml_dsa_87::η, β = ml_dsa_87::β;
+};
+
+// A signing request, as consumed by `sign_batch`. All spans must stay alive until the batch is processed.
+struct sign_request_t
+{
+  param_set_t param_set;
+  std::span<const uint8_t, SigningSeedByteLen> rnd;
+  std::span<const uint8_t> seckey;
+  std::span<const uint8_t> msg;
+  std::span<uint8_t> sig;
+};
+
+// A verification request, as consumed by `verify_batch`. All spans must stay alive until the batch is processed.
+struct verify_request_t
+{
+  param_set_t param_set;
+  std::span<const uint8_t> pubkey;
+  std::span<const uint8_t> msg;
+  std::span<const uint8_t> sig;
+};
+
+// Table of routines and byte lengths of a specific ML-DSA parameter set. Routines taking byte spans return false,
+// without touching outputs, if any of the spans doesn't have the expected length.
+struct vtable_t
+{
+  param_set_t param_set;
+  const char* name;
+
+  size_t pubkey_byte_len;
+  size_t seckey_byte_len;
+  size_t sig_byte_len;
+
+  bool (*keygen)(std::span<const uint8_t, KeygenSeedByteLen> ξ, std::span<uint8_t> pubkey, std::span<uint8_t> seckey);
+  bool (*sign)(std::span<const uint8_t, SigningSeedByteLen> rnd, std::span<const uint8_t> seckey, std::span<const uint8_t> msg, std::span<uint8_t> sig);
+  bool (*verify)(std::span<const uint8_t> pubkey, std::span<const uint8_t> msg, std::span<const uint8_t> sig);
+
+  // Given n requests of this parameter set ( indexed using `idxs` ), this routine processes all of them, writing status
+  // of i-th request to `status[idxs[i]]`.
+  void (*sign_many)(std::span<const sign_request_t> reqs, std::span<const size_t> idxs, std::span<bool> status);
+  void (*verify_many)(std::span<const verify_request_t> reqs, std::span<const size_t> idxs, std::span<bool> status);
+};
+
+namespace internals {
+
+template<param_set_t param_set>
+static constexpr size_t PubKeyByteLen = ml_dsa_utils::pub_key_len(params_t<param_set>::k, params_t<param_set>::d);
+
+template<param_set_t param_set>
+static constexpr size_t SecKeyByteLen =
+  ml_dsa_utils::sec_key_len(params_t<param_set>::k, params_t<param_set>::l, params_t<param_set>::η, params_t<param_set>::d);
+
+template<param_set_t param_set>
+static constexpr size_t SigByteLen =
+  ml_dsa_utils::sig_len(params_t<param_set>::k, params_t<param_set>::l, params_t<param_set>::γ1, params_t<param_set>::ω, params_t<param_set>::λ);
+
+template<param_set_t param_set>
+static inline bool
+keygen(std::span<const uint8_t, KeygenSeedByteLen> ξ, std::span<uint8_t> pubkey, std::span<uint8_t> seckey)
+{
+  using p = params_t<param_set>;
+
+  if ((pubkey.size() != PubKeyByteLen<param_set>) || (seckey.size() != SecKeyByteLen<param_set>)) {
+    return false;
+  }
+
+  auto _pubkey = pubkey.template first<PubKeyByteLen<param_set>>();
+  auto _seckey = seckey.template first<SecKeyByteLen<param_set>>();
+
+  ml_dsa_dispatch::run([&]() { ml_dsa::keygen<p::k, p::l, p::d, p::η>(ξ, _pubkey, _seckey); });
+  return true;
+}
+
+template<param_set_t param_set>
+static inline bool
+sign(std::span<const uint8_t, SigningSeedByteLen> rnd, std::span<const uint8_t> seckey, std::span<const uint8_t> msg, std::span<uint8_t> sig)
+{
+  using p = params_t<param_set>;
+
+  if ((seckey.size() != SecKeyByteLen<param_set>) || (sig.size() != SigByteLen<param_set>)) {
+    return false;
+  }
+
+  auto _seckey = seckey.template first<SecKeyByteLen<param_set>>();
+  auto _sig = sig.template first<SigByteLen<param_set>>();
+
+  ml_dsa_dispatch::run([&]() { ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, _seckey, msg, _sig); });
+  return true;
+}
+
+template<param_set_t param_set>
+static inline bool
+verify(std::span<const uint8_t> pubkey, std::span<const uint8_t> msg, std::span<const uint8_t> sig)
+{
+  using p = params_t<param_set>;
+
+  if ((pubkey.size() != PubKeyByteLen<param_set>) || (sig.size() != SigByteLen<param_set>)) {
+    return false;
+  }
+
+  auto _pubkey = pubkey.template first<PubKeyByteLen<param_set>>();
+  auto _sig = sig.template first<SigByteLen<param_set>>();
+
+  bool is_valid = false;
+  ml_dsa_dispatch::run([&]() { is_valid = ml_dsa::verify<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(_pubkey, msg, _sig); });
+  return is_valid;
+}
+
+// Signs a group of requests, all of same parameter set, within a single invocation of the active backend. Secret key
+// is expanded only when it differs from the one used by previous request, so consecutive requests signed by the same
+// key share one prepared secret key.
+template<param_set_t param_set>
+static inline void
+sign_many(std::span<const sign_request_t> reqs, std::span<const size_t> idxs, std::span<bool> status)
+{
+  using p = params_t<param_set>;
+  using prepared_seckey_t = ml_dsa::prepared_seckey_t<p::k, p::l>;
+
+  auto prepared = std::make_unique<prepared_seckey_t>();
+
+  ml_dsa_dispatch::run([&]() {
+    std::span<const uint8_t> prepared_from{};
+
+    for (const size_t idx : idxs) {
+      const auto& req = reqs[idx];
+
+      if ((req.seckey.size() != SecKeyByteLen<param_set>) || (req.sig.size() != SigByteLen<param_set>)) {
+        status[idx] = false;
+        continue;
+      }
+
+      auto seckey = req.seckey.template first<SecKeyByteLen<param_set>>();
+      auto sig = req.sig.template first<SigByteLen<param_set>>();
+
+      const bool is_same_key =
+        (prepared_from.size() == seckey.size()) &&
+        ((prepared_from.data() == seckey.data()) || std::equal(prepared_from.begin(), prepared_from.end(), seckey.begin()));
+
+      if (!is_same_key) {
+        ml_dsa::prepare_seckey<p::k, p::l, p::d, p::η>(seckey, *prepared);
+        prepared_from = req.seckey;
+      }
+
+      ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(req.rnd, *prepared, req.msg, sig);
+      status[idx] = true;
+    }
+  });
+}
+
+// Verifies a group of requests, all of same parameter set, within a single invocation of the active backend.
+// Consecutive requests, verified under the same public key, share the prepared public key and are verified together,
+// see `ml_dsa::verify_many`.
+template<param_set_t param_set>
+static inline void
+verify_many(std::span<const verify_request_t> reqs, std::span<const size_t> idxs, std::span<bool> status)
+{
+  using p = params_t<param_set>;
+  using prepared_pubkey_t = ml_dsa::prepared_pubkey_t<p::k, p::l>;
+  using sig_t = std::span<const uint8_t, SigByteLen<param_set>>;
+
+  constexpr size_t B = ml_dsa::VERIFY_MANY_BATCH_SIZE;
+
+  auto prepared = std::make_unique<prepared_pubkey_t>();
+
+  ml_dsa_dispatch::run([&]() {
+    std::span<const uint8_t> prepared_from{};
+
+    // Requests, pending verification under the prepared public key
+    std::vector<size_t> run_idxs;
+    std::vector<std::span<const uint8_t>> run_msgs;
+    std::vector<sig_t> run_sigs;
+    std::array<bool, B> run_status{};
+
+    auto flush = [&]() {
+      ml_dsa::verify_many<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(*prepared, run_msgs, run_sigs, std::span(run_status).first(run_sigs.size()));
+
+      for (size_t i = 0; i < run_idxs.size(); i++) {
+        status[run_idxs[i]] = run_status[i];
+      }
+
+      run_idxs.clear();
+      run_msgs.clear();
+      run_sigs.clear();
+    };
+
+    for (const size_t idx : idxs) {
+      const auto& req = reqs[idx];
+
+      if ((req.pubkey.size() != PubKeyByteLen<param_set>) || (req.sig.size() != SigByteLen<param_set>)) {
+        status[idx] = false;
+        continue;
+      }
+
+      auto pubkey = req.pubkey.template first<PubKeyByteLen<param_set>>();
+
+      const bool is_same_key =
+        (prepared_from.size() == pubkey.size()) &&
+        ((prepared_from.data() == pubkey.data()) || std::equal(prepared_from.begin(), prepared_from.end(), pubkey.begin()));
+
+      if (!is_same_key || (run_sigs.size() == B)) {
+        flush();
+      }
+      if (!is_same_key) {
+        ml_dsa::prepare_pubkey<p::k, p::l, p::d>(pubkey, *prepared);
+        prepared_from = req.pubkey;
+      }
+
+      run_idxs.push_back(idx);
+      run_msgs.push_back(req.msg);
+      run_sigs.push_back(req.sig.template first<SigByteLen<param_set>>());
+    }
+
+    flush();
+  });
+}
+
+template<param_set_t param_set>
+static constexpr vtable_t
+make_vtable(const char* name)
+{
+  return vtable_t{
+    .param_set = param_set,
+    .name = name,
+    .pubkey_byte_len = PubKeyByteLen<param_set>,
+    .seckey_byte_len = SecKeyByteLen<param_set>,
+    .sig_byte_len = SigByteLen<param_set>,
+    .keygen = keygen<param_set>,
+    .sign = sign<param_set>,
+    .verify = verify<param_set>,
+    .sign_many = sign_many<param_set>,
+    .verify_many = verify_many<param_set>,
+  };
+}
+
+// Dispatch table, indexed by `param_set_t`.
+static constexpr std::array<vtable_t, PARAM_SET_CNT> VTABLES{
+  make_vtable<param_set_t::ml_dsa_44>("ML-DSA-44"),
+  make_vtable<param_set_t::ml_dsa_65>("ML-DSA-65"),
+  make_vtable<param_set_t::ml_dsa_87>("ML-DSA-87"),
+};
+
+// Given parameter set of each of n requests, this routine computes a permutation of request indices, such that
+// requests are grouped by parameter set, while preserving their relative order within a group. Returns offsets
+// s.t. indices of requests of i-th parameter set live in [offsets[i], offsets[i+1]). Requests with invalid parameter
+// set are left out of all groups, with their status set to false.
+template<typename request_t>
+static inline std::array<size_t, PARAM_SET_CNT + 1>
+group_by_param_set(std::span<const request_t> reqs, std::vector<size_t>& idxs, std::span<bool> status)
+{
+  std::array<size_t, PARAM_SET_CNT + 1> offsets{};
+  for (size_t i = 0; i < reqs.size(); i++) {
+    const size_t param_set = static_cast<size_t>(reqs[i].param_set);
+
+    if (param_set < PARAM_SET_CNT) {
+      offsets[param_set + 1]++;
+    } else {
+      status[i] = false;
+    }
+  }
+  for (size_t i = 0; i < PARAM_SET_CNT; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  auto cursors = offsets;
+  idxs.resize(offsets[PARAM_SET_CNT]);
+  for (size_t i = 0; i < reqs.size(); i++) {
+    const size_t param_set = static_cast<size_t>(reqs[i].param_set);
+
+    if (param_set < PARAM_SET_CNT) {
+      idxs[cursors[param_set]++] = i;
+    }
+  }
+
+  return offsets;
+}
+
+}
+
+// Returns true if `param_set` names one of the supported ML-DSA parameter sets.
+static inline constexpr bool
+is_valid(const param_set_t param_set)
+{
+  return static_cast<size_t>(param_set) < PARAM_SET_CNT;
+}
+
+// Given a ML-DSA parameter set, this routine returns table of routines and byte lengths of that parameter set.
+// Parameter set must be valid, see `is_valid`.
+static inline constexpr const vtable_t&
+select(const param_set_t param_set)
+{
+  return internals::VTABLES[static_cast<size_t>(param_set)];
+}
+
+// Given a 32 -bytes seed, this routine generates a fresh keypair of requested parameter set, returning false if
+// parameter set is invalid or byte lengths of key spans don't match it.
+static inline bool
+keygen(const param_set_t param_set, std::span<const uint8_t, KeygenSeedByteLen> ξ, std::span<uint8_t> pubkey, std::span<uint8_t> seckey)
+{
+  return is_valid(param_set) && select(param_set).keygen(ξ, pubkey, seckey);
+}
+
+// Given a 32 -bytes seed `rnd` and a secret key of requested parameter set, this routine signs message M, returning
+// false if parameter set is invalid or byte lengths of secret key or signature spans don't match it.
+static inline bool
+sign(const param_set_t param_set,
+     std::span<const uint8_t, SigningSeedByteLen> rnd,
+     std::span<const uint8_t> seckey,
+     std::span<const uint8_t> msg,
+     std::span<uint8_t> sig)
+{
+  return is_valid(param_set) && select(param_set).sign(rnd, seckey, msg, sig);
+}
+
+// Given a public key of requested parameter set, a message M and a signature S, this routine returns truth value only
+// in case of successful signature verification. Invalid parameter set or byte lengths result in failed verification.
+static inline bool
+verify(const param_set_t param_set, std::span<const uint8_t> pubkey, std::span<const uint8_t> msg, std::span<const uint8_t> sig)
+{
+  return is_valid(param_set) && select(param_set).verify(pubkey, msg, sig);
+}
+
+// Given n signing requests, possibly of different parameter sets, this routine groups them by parameter set and
+// signs each group in one go, writing whether i-th request was signed to `status[i]`. Consecutive requests, of same
+// parameter set, signed by the same secret key, share the expanded secret key. Number of requests and length of
+// `status` must be equal.
+static inline void
+sign_batch(std::span<const sign_request_t> reqs, std::span<bool> status)
+{
+  std::vector<size_t> idxs;
+  const auto offsets = internals::group_by_param_set(reqs, idxs, status);
+
+  for (size_t i = 0; i < PARAM_SET_CNT; i++) {
+    if (offsets[i] == offsets[i + 1]) {
+      continue;
+    }
+
+    const auto group = std::span<const size_t>(idxs).subspan(offsets[i], offsets[i + 1] - offsets[i]);
+    internals::VTABLES[i].sign_many(reqs, group, status);
+  }
+}
+
+// Given n verification requests, possibly of different parameter sets, this routine groups them by parameter set and
+// verifies each group in one go, writing verification result of i-th request to `status[i]`. Consecutive requests, of
+// same parameter set, verified under the same public key, share the expanded public key. Number of requests and
+// length of `status` must be equal.
+static inline void
+verify_batch(std::span<const verify_request_t> reqs, std::span<bool> status)
+{
+  std::vector<size_t> idxs;
+  const auto offsets = internals::group_by_param_set(reqs, idxs, status);
+
+  for (size_t i = 0; i < PARAM_SET_CNT; i++) {
+    if (offsets[i] == offsets[i + 1]) {
+      continue;
+    }
+
+    const auto group = std::span<const size_t>(idxs).subspan(offsets[i], offsets[i + 1] - offsets[i]);
+    internals::VTABLES[i].verify_many(reqs, group, status);
+  }
+}
+
+}
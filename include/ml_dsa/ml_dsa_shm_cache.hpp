@@ -0,0 +1,269 @@
+#pragma once
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Cross-process cache of prepared ML-DSA public keys, living in POSIX shared memory
+//
+// Prefork servers run many worker processes, each of which would otherwise expand and cache the same public keys on
+// its own. This cache lives in a named POSIX shared memory segment, created once ( say, by the master process ) and
+// attached by every worker, so that a public key is expanded by whichever worker sees it first and all other workers
+// on the host verify signatures using that single copy.
+//
+// The segment is a direct-mapped table of buckets, each holding one prepared public key, indexed by its public key
+// hash tr = H(pk, 64), which also identifies the key. Each bucket is protected by a seqlock i.e. a sequence number,
+// which is odd while the bucket is being written. Readers never block: they verify the signature in place, using the
+// prepared key inside the bucket, and accept the result only if the sequence number was even and unchanged all along,
+// otherwise they prepare the key on their own stack. Writers claim a bucket by atomically making its sequence number
+// odd, expand the key right into it and make it even again. If the bucket is already claimed, the key is prepared on
+// the stack instead, so that nobody ever waits. A key hashing to an occupied bucket evicts the key living there.
+//
+// Any process, which can write to the segment, can make forged signatures verify for keys it caches, hence all of them
+// must belong to the same trust domain, which is why the segment is only accessible to its owner, by default. A worker
+// dying while writing a bucket leaves it claimed forever, which only makes keys hashing to that bucket miss the cache.
+// Builds, attaching to the same segment, must agree on parameter set and layout of prepared keys, which is checked.
+namespace ml_dsa_shm_cache {
+
+// Magic bytes, a cache segment starts with.
+static constexpr std::array<char, 8> MAGIC = { 'M', 'L', 'D', 'S', 'A', 'S', 'H', 'M' };
+
+// Version of segment layout, to be bumped on any change to layout of header, buckets or prepared keys.
+static constexpr uint32_t VERSION = 1;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Seqlocks, shared among processes, must be lock-free !");
+
+// Counters of cache events, summed over all processes using the segment.
+struct stats_t
+{
+  uint64_t hits = 0;      // Signatures verified using a prepared key, found in the cache
+  uint64_t misses = 0;    // Signatures verified after preparing the key, as it wasn't found in the cache
+  uint64_t inserts = 0;   // Prepared keys written to the cache, evicting previous occupant of the bucket, if any
+  uint64_t contended = 0; // Misses, for which the bucket was being written by someone else, so the key wasn't cached
+};
+
+template<ml_dsa_runtime::param_set_t param_set, bool packed = false>
+class cache_t
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+
+public:
+  using prepared_t = ml_dsa::prepared_pubkey_t<p::k, p::l, packed>;
+
+  static constexpr size_t PUBKEY_BYTE_LEN = ml_dsa_utils::pub_key_len(p::k, p::d);
+  static constexpr size_t SIG_BYTE_LEN = ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ);
+
+private:
+  struct alignas(64) header_t
+  {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t param_set_id; // 44, 65 or 87, see `ml_dsa_probes::PARAM_SET`
+    uint64_t bucket_cnt;
+    uint64_t bucket_byte_len;
+
+    alignas(64) std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> inserts;
+    std::atomic<uint64_t> contended;
+  };
+
+  struct alignas(64) bucket_t
+  {
+    std::atomic<uint64_t> seq; // Even, when bucket is stable. Zero, when bucket was never written.
+    prepared_t prepared;       // Its tr identifies the public key
+  };
+
+  header_t* header = nullptr;
+  bucket_t* buckets = nullptr;
+  size_t segment_len = 0;
+
+  cache_t(void* const segment, const size_t len)
+    : header(static_cast<header_t*>(segment))
+    , buckets(reinterpret_cast<bucket_t*>(static_cast<uint8_t*>(segment) + sizeof(header_t)))
+    , segment_len(len)
+  {
+  }
+
+  static constexpr size_t segment_byte_len(const size_t bucket_cnt) { return sizeof(header_t) + bucket_cnt * sizeof(bucket_t); }
+
+  static constexpr uint32_t PARAM_SET_ID = ml_dsa_probes::PARAM_SET<p::k, p::l>;
+
+  // Given a public key, this routine computes its hash tr = H(pk, 64), which is both the cache key and part of μ.
+  static void hash_pubkey(std::span<const uint8_t, PUBKEY_BYTE_LEN> pubkey, std::span<uint8_t, 64> tr)
+  {
+    shake256::shake256_t hasher;
+    hasher.absorb(pubkey);
+    hasher.finalize();
+    hasher.squeeze(tr);
+  }
+
+  bucket_t& bucket_of(std::span<const uint8_t, 64> tr) const
+  {
+    uint64_t h = 0;
+    std::memcpy(&h, tr.data(), sizeof(h));
+    return buckets[h % header->bucket_cnt];
+  }
+
+  static bool verify_mu(const prepared_t& prepared, std::span<const uint8_t, ml_dsa::MU_BYTE_LEN> mu, std::span<const uint8_t, SIG_BYTE_LEN> sig)
+  {
+    return ml_dsa::verify_mu<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(prepared, mu, sig);
+  }
+
+public:
+  cache_t(const cache_t&) = delete;
+  cache_t& operator=(const cache_t&) = delete;
+
+  ~cache_t() { munmap(header, segment_len); }
+
+  // Creates a cache of `bucket_cnt` buckets, in a fresh shared memory segment named `name` ( say "/ml_dsa_65" ),
+  // replacing any segment of that name. Returns nullptr, if the segment can't be created.
+  static std::unique_ptr<cache_t> create(const std::string& name, const size_t bucket_cnt, const mode_t mode = 0600)
+  {
+    if (bucket_cnt == 0) {
+      return nullptr;
+    }
+
+    shm_unlink(name.c_str());
+
+    const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, mode);
+    if (fd < 0) {
+      return nullptr;
+    }
+
+    const size_t len = segment_byte_len(bucket_cnt);
+    void* segment = MAP_FAILED;
+
+    if (ftruncate(fd, static_cast<off_t>(len)) == 0) {
+      segment = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (segment == MAP_FAILED) {
+      shm_unlink(name.c_str());
+      return nullptr;
+    }
+
+    // Fresh segment is zero-filled, which is a valid state of all atomics and of all buckets, hence only the header
+    // needs to be written. Magic goes last, so that nobody attaches to a half-written header.
+    auto* hdr = static_cast<header_t*>(segment);
+    hdr->version = VERSION;
+    hdr->param_set_id = PARAM_SET_ID;
+    hdr->bucket_cnt = bucket_cnt;
+    hdr->bucket_byte_len = sizeof(bucket_t);
+
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(hdr->magic.data(), MAGIC.data(), MAGIC.size());
+
+    return std::unique_ptr<cache_t>(new cache_t(segment, len));
+  }
+
+  // Attaches to a cache, previously created by `create`, possibly in another process. Returns nullptr, if there's no
+  // such segment or it was created for another parameter set or by an incompatible build.
+  static std::unique_ptr<cache_t> attach(const std::string& name)
+  {
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+      return nullptr;
+    }
+
+    struct stat st{};
+    void* segment = MAP_FAILED;
+
+    if ((fstat(fd, &st) == 0) && (static_cast<size_t>(st.st_size) >= sizeof(header_t))) {
+      segment = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (segment == MAP_FAILED) {
+      return nullptr;
+    }
+
+    auto cache = std::unique_ptr<cache_t>(new cache_t(segment, static_cast<size_t>(st.st_size)));
+    const auto* hdr = cache->header;
+
+    const bool is_compatible = (std::memcmp(hdr->magic.data(), MAGIC.data(), MAGIC.size()) == 0) && (hdr->version == VERSION) &&
+                               (hdr->param_set_id == PARAM_SET_ID) && (hdr->bucket_byte_len == sizeof(bucket_t)) && (hdr->bucket_cnt > 0) &&
+                               (segment_byte_len(hdr->bucket_cnt) == cache->segment_len);
+
+    return is_compatible ? std::move(cache) : nullptr;
+  }
+
+  // Removes the named segment. Processes, which are attached to it, keep using it, until they detach.
+  static void unlink(const std::string& name) { shm_unlink(name.c_str()); }
+
+  // Number of buckets i.e. maximum number of prepared public keys, the cache can hold.
+  size_t capacity() const { return header->bucket_cnt; }
+
+  // Returns counters of cache events, summed over all processes using the cache.
+  stats_t stats() const
+  {
+    return stats_t{
+      .hits = header->hits.load(std::memory_order_relaxed),
+      .misses = header->misses.load(std::memory_order_relaxed),
+      .inserts = header->inserts.load(std::memory_order_relaxed),
+      .contended = header->contended.load(std::memory_order_relaxed),
+    };
+  }
+
+  // Given a public key, a message and a signature, this routine verifies the signature, same as `verify` of respective
+  // parameter set does, using prepared public key from the cache, if present, otherwise preparing it and trying to
+  // insert it into the cache.
+  bool verify(std::span<const uint8_t, PUBKEY_BYTE_LEN> pubkey, std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig)
+  {
+    std::array<uint8_t, 64> tr{};
+    std::array<uint8_t, ml_dsa::MU_BYTE_LEN> mu{};
+
+    bool is_valid = false;
+
+    ml_dsa_dispatch::run([&]() {
+      hash_pubkey(pubkey, tr);
+      ml_dsa::compute_mu(tr, msg, mu);
+
+      bucket_t& bucket = bucket_of(tr);
+
+      // Optimistic read of the bucket, result of which is accepted only if no writer touched it meanwhile.
+      const uint64_t seq0 = bucket.seq.load(std::memory_order_acquire);
+      if ((seq0 != 0) && (seq0 % 2 == 0) && (bucket.prepared.tr == tr)) {
+        const bool result = verify_mu(bucket.prepared, mu, sig);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (bucket.seq.load(std::memory_order_relaxed) == seq0) {
+          header->hits.fetch_add(1, std::memory_order_relaxed);
+          is_valid = result;
+          return;
+        }
+      }
+
+      header->misses.fetch_add(1, std::memory_order_relaxed);
+
+      // Claim the bucket, expand the key right into it and verify, before releasing it.
+      uint64_t seq1 = bucket.seq.load(std::memory_order_relaxed);
+      if ((seq1 % 2 == 0) && bucket.seq.compare_exchange_strong(seq1, seq1 + 1, std::memory_order_relaxed)) {
+        std::atomic_thread_fence(std::memory_order_release);
+
+        ml_dsa::prepare_pubkey<p::k, p::l, p::d>(pubkey, bucket.prepared);
+        is_valid = verify_mu(bucket.prepared, mu, sig);
+
+        bucket.seq.store(seq1 + 2, std::memory_order_release);
+        header->inserts.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+
+      header->contended.fetch_add(1, std::memory_order_relaxed);
+
+      prepared_t prepared{};
+      ml_dsa::prepare_pubkey<p::k, p::l, p::d>(pubkey, prepared);
+      is_valid = verify_mu(prepared, mu, sig);
+    });
+
+    return is_valid;
+  }
+};
+
+}
@@ -0,0 +1,251 @@
+#pragma once
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
+
+// In-process cache of successful ML-DSA signature verifications
+//
+// Some protocols ( certificate chains, gossip re-broadcast ) make us verify the very same signature over the very same
+// message, under the very same public key, over and over again. This cache remembers 32 -bytes tags of (public key,
+// message, signature) triples, which were found valid, so that verifying them again costs hashing of the public key,
+// the message and the signature, instead of a full verification.
+//
+// Tag of a triple is SHAKE256(parameter set || μ || signature), where μ = H(tr || M', 64) already binds public key
+// hash tr and the message. Only valid signatures are ever cached, hence an attacker can't poison the cache with
+// negatives, while invalid signatures always go through full verification. A false positive requires two distinct
+// triples with the same 256 -bit tag.
+//
+// The cache is a fixed size, 4 -way set-associative table, safe to be shared by many threads. Each slot is protected by
+// a seqlock i.e. a sequence number, which is odd while the slot is being written, so lookups never block and never see
+// a torn tag. Inserts claim the next slot of the set, in FIFO order, skipping the insert, if that slot is being written
+// by someone else, so that nobody ever waits.
+namespace ml_dsa_verify_cache {
+
+// Byte length of tag, identifying a (public key, message, signature) triple.
+static constexpr size_t TAG_BYTE_LEN = 32;
+
+// Byte length of public key and signature of given parameter set.
+template<ml_dsa_runtime::param_set_t param_set>
+static constexpr size_t PUBKEY_BYTE_LEN = ml_dsa_utils::pub_key_len(ml_dsa_runtime::params_t<param_set>::k, ml_dsa_runtime::params_t<param_set>::d);
+
+template<ml_dsa_runtime::param_set_t param_set>
+static constexpr size_t SIG_BYTE_LEN = ml_dsa_utils::sig_len(ml_dsa_runtime::params_t<param_set>::k,
+                                                             ml_dsa_runtime::params_t<param_set>::l,
+                                                             ml_dsa_runtime::params_t<param_set>::γ1,
+                                                             ml_dsa_runtime::params_t<param_set>::ω,
+                                                             ml_dsa_runtime::params_t<param_set>::λ);
+
+// Counters of cache events, summed over all threads using the cache.
+struct stats_t
+{
+  uint64_t hits = 0;    // Signatures found valid in the cache
+  uint64_t misses = 0;  // Signatures, not found in the cache, which went through full verification
+  uint64_t inserts = 0; // Signatures found valid by full verification and written to the cache
+};
+
+class cache_t
+{
+  static constexpr size_t WAYS = 4;
+  static constexpr size_t TAG_WORD_CNT = TAG_BYTE_LEN / sizeof(uint64_t);
+
+  struct slot_t
+  {
+    std::atomic<uint64_t> seq; // Even, when slot is stable. Zero, when slot was never written.
+    std::array<std::atomic<uint64_t>, TAG_WORD_CNT> tag;
+  };
+
+  struct alignas(64) set_t
+  {
+    std::array<slot_t, WAYS> slots;
+    std::atomic<uint32_t> next; // Slot to be replaced by next insert
+  };
+
+  struct alignas(64) counters_t
+  {
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> inserts;
+  };
+
+  std::unique_ptr<set_t[]> sets;
+  size_t set_cnt = 0;
+  counters_t counters{};
+
+  using tag_t = std::array<uint64_t, TAG_WORD_CNT>;
+
+  static tag_t to_words(std::span<const uint8_t, TAG_BYTE_LEN> tag)
+  {
+    tag_t words{};
+    std::memcpy(words.data(), tag.data(), tag.size());
+    return words;
+  }
+
+  set_t& set_of(const tag_t& words) const { return sets[words[0] & (set_cnt - 1)]; }
+
+public:
+  // Creates an empty cache, holding at least `capacity` tags, rounded up to a power of 2 multiple of its associativity.
+  explicit cache_t(const size_t capacity)
+    : set_cnt(std::bit_ceil(std::max<size_t>((capacity + WAYS - 1) / WAYS, 1)))
+  {
+    sets = std::make_unique<set_t[]>(set_cnt);
+  }
+
+  cache_t(const cache_t&) = delete;
+  cache_t& operator=(const cache_t&) = delete;
+
+  // Maximum number of tags, the cache can hold.
+  size_t capacity() const { return set_cnt * WAYS; }
+
+  // Returns counters of cache events, summed over all threads using the cache.
+  stats_t stats() const
+  {
+    return stats_t{
+      .hits = counters.hits.load(std::memory_order_relaxed),
+      .misses = counters.misses.load(std::memory_order_relaxed),
+      .inserts = counters.inserts.load(std::memory_order_relaxed),
+    };
+  }
+
+  // Given a tag, this routine returns true, if it's present in the cache, counting a hit, otherwise counts a miss.
+  bool lookup(std::span<const uint8_t, TAG_BYTE_LEN> tag)
+  {
+    const tag_t words = to_words(tag);
+    set_t& set = set_of(words);
+
+    for (const auto& slot : set.slots) {
+      const uint64_t seq0 = slot.seq.load(std::memory_order_acquire);
+      if ((seq0 == 0) || (seq0 % 2 == 1)) {
+        continue;
+      }
+
+      bool is_equal = true;
+      for (size_t i = 0; i < TAG_WORD_CNT; i++) {
+        is_equal &= slot.tag[i].load(std::memory_order_relaxed) == words[i];
+      }
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (is_equal && (slot.seq.load(std::memory_order_relaxed) == seq0)) {
+        counters.hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+
+    counters.misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  // Given a tag of a valid signature, this routine writes it to the cache, evicting the oldest tag of its set. Insert is
+  // skipped, if the slot to be replaced is being written by another thread.
+  void insert(std::span<const uint8_t, TAG_BYTE_LEN> tag)
+  {
+    const tag_t words = to_words(tag);
+    set_t& set = set_of(words);
+    slot_t& slot = set.slots[set.next.fetch_add(1, std::memory_order_relaxed) % WAYS];
+
+    uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    if ((seq % 2 == 1) || !slot.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_relaxed)) {
+      return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < TAG_WORD_CNT; i++) {
+      slot.tag[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+    counters.inserts.fetch_add(1, std::memory_order_relaxed);
+  }
+};
+
+// Given μ and a signature, this routine computes tag of the (public key, message, signature) triple, for given
+// parameter set.
+template<ml_dsa_runtime::param_set_t param_set>
+static inline void
+compute_tag(std::span<const uint8_t, ml_dsa::MU_BYTE_LEN> mu, std::span<const uint8_t, SIG_BYTE_LEN<param_set>> sig, std::span<uint8_t, TAG_BYTE_LEN> tag)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  const std::array<uint8_t, 1> domain = { static_cast<uint8_t>(ml_dsa_probes::PARAM_SET<p::k, p::l>) };
+
+  shake256::shake256_t hasher;
+  hasher.absorb(domain);
+  hasher.absorb(mu);
+  hasher.absorb(sig);
+  hasher.finalize();
+  hasher.squeeze(tag);
+}
+
+// Given a prepared public key, μ and a signature, this routine verifies the signature, same as `verify_mu` of respective
+// parameter set does, unless it's already known to be valid, caching it, if it's found valid.
+template<ml_dsa_runtime::param_set_t param_set, bool packed>
+static inline bool
+verify_mu(cache_t& cache,
+          const ml_dsa::prepared_pubkey_t<ml_dsa_runtime::params_t<param_set>::k, ml_dsa_runtime::params_t<param_set>::l, packed>& prepared,
+          std::span<const uint8_t, ml_dsa::MU_BYTE_LEN> mu,
+          std::span<const uint8_t, SIG_BYTE_LEN<param_set>> sig)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+
+  std::array<uint8_t, TAG_BYTE_LEN> tag{};
+  bool is_valid = false;
+
+  ml_dsa_dispatch::run([&]() {
+    compute_tag<param_set>(mu, sig, tag);
+    if (cache.lookup(tag)) {
+      is_valid = true;
+      return;
+    }
+
+    is_valid = ml_dsa::verify_mu<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(prepared, mu, sig);
+    if (is_valid) {
+      cache.insert(tag);
+    }
+  });
+
+  return is_valid;
+}
+
+// Given a public key, a message and a signature, this routine verifies the signature, same as `verify` of respective
+// parameter set does, unless it's already known to be valid, caching it, if it's found valid. The public key is only
+// expanded on a miss.
+template<ml_dsa_runtime::param_set_t param_set>
+static inline bool
+verify(cache_t& cache,
+       std::span<const uint8_t, PUBKEY_BYTE_LEN<param_set>> pubkey,
+       std::span<const uint8_t> msg,
+       std::span<const uint8_t, SIG_BYTE_LEN<param_set>> sig)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+
+  std::array<uint8_t, 64> tr{};
+  std::array<uint8_t, ml_dsa::MU_BYTE_LEN> mu{};
+  std::array<uint8_t, TAG_BYTE_LEN> tag{};
+  bool is_valid = false;
+
+  ml_dsa_dispatch::run([&]() {
+    shake256::shake256_t hasher;
+    hasher.absorb(pubkey);
+    hasher.finalize();
+    hasher.squeeze(tr);
+
+    ml_dsa::compute_mu(tr, msg, mu);
+    compute_tag<param_set>(mu, sig, tag);
+    if (cache.lookup(tag)) {
+      is_valid = true;
+      return;
+    }
+
+    ml_dsa::prepared_pubkey_t<p::k, p::l> prepared{};
+    ml_dsa::prepare_pubkey<p::k, p::l, p::d>(pubkey, prepared);
+
+    is_valid = ml_dsa::verify_mu<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(prepared, mu, sig);
+    if (is_valid) {
+      cache.insert(tag);
+    }
+  });
+
+  return is_valid;
+}
+
+}
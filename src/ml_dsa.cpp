@@ -0,0 +1,301 @@
+#include "ml_dsa/ml_dsa.h"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <memory>
+#include <new>
+#include <variant>
+#include <vector>
+
+// Implementation of the C ABI, declared in include/ml_dsa/ml_dsa.h, on top of runtime parameter set selection API.
+// This translation unit instantiates ML-DSA routines of all three parameter sets, via dispatch table of
+// `ml_dsa_runtime`, and is the only one compiled into `libmldsa.{so,a}`. No C++ exception crosses the C ABI.
+
+static_assert(ML_DSA_KEYGEN_SEED_BYTE_LEN == ml_dsa_runtime::KeygenSeedByteLen);
+static_assert(ML_DSA_SIGNING_SEED_BYTE_LEN == ml_dsa_runtime::SigningSeedByteLen);
+
+static_assert(static_cast<size_t>(ML_DSA_44) == static_cast<size_t>(ml_dsa_runtime::param_set_t::ml_dsa_44));
+static_assert(static_cast<size_t>(ML_DSA_65) == static_cast<size_t>(ml_dsa_runtime::param_set_t::ml_dsa_65));
+static_assert(static_cast<size_t>(ML_DSA_87) == static_cast<size_t>(ml_dsa_runtime::param_set_t::ml_dsa_87));
+
+struct ml_dsa_prepared_seckey
+{
+  std::variant<ml_dsa_44::prepared_seckey_t, ml_dsa_65::prepared_seckey_t, ml_dsa_87::prepared_seckey_t> key;
+};
+
+namespace {
+
+// Returns dispatch table of parameter set, or nullptr, if parameter set is unknown.
+const ml_dsa_runtime::vtable_t*
+select_vtable(const ml_dsa_param_set_t param_set)
+{
+  const auto ps = static_cast<ml_dsa_runtime::param_set_t>(param_set);
+  return ml_dsa_runtime::is_valid(ps) ? &ml_dsa_runtime::select(ps) : nullptr;
+}
+
+// Overwrites n -bytes, starting at `ptr`, with zeros, in a way compiler can't optimize away.
+void
+wipe(void* const ptr, const size_t n)
+{
+  auto bytes = static_cast<volatile uint8_t*>(ptr);
+  for (size_t i = 0; i < n; i++) {
+    bytes[i] = 0;
+  }
+}
+
+// Signs message using prepared secret key of parameter set `param_set`, after checking byte length of signature.
+template<ml_dsa_runtime::param_set_t param_set, typename prepared_seckey_t>
+int
+sign_prepared(const prepared_seckey_t& prepared, const uint8_t* const rnd, std::span<const uint8_t> msg, std::span<uint8_t> sig)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  constexpr size_t sig_len = ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ);
+
+  if (sig.size() != sig_len) {
+    return ML_DSA_ERR_LENGTH;
+  }
+
+  const auto _rnd = std::span<const uint8_t, ML_DSA_SIGNING_SEED_BYTE_LEN>(rnd, ML_DSA_SIGNING_SEED_BYTE_LEN);
+  const auto _sig = sig.template first<sig_len>();
+
+  ml_dsa_dispatch::run([&]() { ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(_rnd, prepared, msg, _sig); });
+  return ML_DSA_OK;
+}
+
+}
+
+size_t
+ml_dsa_pubkey_byte_len(const ml_dsa_param_set_t param_set)
+{
+  const auto vtable = select_vtable(param_set);
+  return (vtable == nullptr) ? 0 : vtable->pubkey_byte_len;
+}
+
+size_t
+ml_dsa_seckey_byte_len(const ml_dsa_param_set_t param_set)
+{
+  const auto vtable = select_vtable(param_set);
+  return (vtable == nullptr) ? 0 : vtable->seckey_byte_len;
+}
+
+size_t
+ml_dsa_sig_byte_len(const ml_dsa_param_set_t param_set)
+{
+  const auto vtable = select_vtable(param_set);
+  return (vtable == nullptr) ? 0 : vtable->sig_byte_len;
+}
+
+int
+ml_dsa_keygen(const ml_dsa_param_set_t param_set,
+              const uint8_t seed[ML_DSA_KEYGEN_SEED_BYTE_LEN],
+              uint8_t* const pubkey,
+              const size_t pubkey_len,
+              uint8_t* const seckey,
+              const size_t seckey_len)
+{
+  const auto vtable = select_vtable(param_set);
+  if (vtable == nullptr) {
+    return ML_DSA_ERR_PARAM_SET;
+  }
+
+  const auto _seed = std::span<const uint8_t, ML_DSA_KEYGEN_SEED_BYTE_LEN>(seed, ML_DSA_KEYGEN_SEED_BYTE_LEN);
+  return vtable->keygen(_seed, std::span(pubkey, pubkey_len), std::span(seckey, seckey_len)) ? ML_DSA_OK : ML_DSA_ERR_LENGTH;
+}
+
+int
+ml_dsa_sign(const ml_dsa_param_set_t param_set,
+            const uint8_t rnd[ML_DSA_SIGNING_SEED_BYTE_LEN],
+            const uint8_t* const seckey,
+            const size_t seckey_len,
+            const uint8_t* const msg,
+            const size_t msg_len,
+            uint8_t* const sig,
+            const size_t sig_len)
+{
+  const auto vtable = select_vtable(param_set);
+  if (vtable == nullptr) {
+    return ML_DSA_ERR_PARAM_SET;
+  }
+
+  const auto _rnd = std::span<const uint8_t, ML_DSA_SIGNING_SEED_BYTE_LEN>(rnd, ML_DSA_SIGNING_SEED_BYTE_LEN);
+  return vtable->sign(_rnd, std::span(seckey, seckey_len), std::span(msg, msg_len), std::span(sig, sig_len)) ? ML_DSA_OK : ML_DSA_ERR_LENGTH;
+}
+
+int
+ml_dsa_verify(const ml_dsa_param_set_t param_set,
+              const uint8_t* const pubkey,
+              const size_t pubkey_len,
+              const uint8_t* const msg,
+              const size_t msg_len,
+              const uint8_t* const sig,
+              const size_t sig_len)
+{
+  const auto vtable = select_vtable(param_set);
+  if (vtable == nullptr) {
+    return ML_DSA_ERR_PARAM_SET;
+  }
+  if ((pubkey_len != vtable->pubkey_byte_len) || (sig_len != vtable->sig_byte_len)) {
+    return ML_DSA_ERR_LENGTH;
+  }
+
+  const bool is_valid = vtable->verify(std::span(pubkey, pubkey_len), std::span(msg, msg_len), std::span(sig, sig_len));
+  return is_valid ? ML_DSA_OK : ML_DSA_ERR_INVALID_SIGNATURE;
+}
+
+ml_dsa_prepared_seckey_t*
+ml_dsa_prepare_seckey(const ml_dsa_param_set_t param_set, const uint8_t* const seckey, const size_t seckey_len, int* const status)
+{
+  int result = ML_DSA_OK;
+  ml_dsa_prepared_seckey_t* prepared = nullptr;
+
+  const auto vtable = select_vtable(param_set);
+  if (vtable == nullptr) {
+    result = ML_DSA_ERR_PARAM_SET;
+  } else if (seckey_len != vtable->seckey_byte_len) {
+    result = ML_DSA_ERR_LENGTH;
+  } else {
+    prepared = new (std::nothrow) ml_dsa_prepared_seckey_t{};
+    if (prepared == nullptr) {
+      result = ML_DSA_ERR_ALLOC;
+    }
+  }
+
+  if (prepared != nullptr) {
+    switch (param_set) {
+      case ML_DSA_44:
+        ml_dsa_44::prepare_seckey(std::span<const uint8_t, ml_dsa_44::SecKeyByteLen>(seckey, seckey_len), prepared->key.emplace<0>());
+        break;
+      case ML_DSA_65:
+        ml_dsa_65::prepare_seckey(std::span<const uint8_t, ml_dsa_65::SecKeyByteLen>(seckey, seckey_len), prepared->key.emplace<1>());
+        break;
+      case ML_DSA_87:
+        ml_dsa_87::prepare_seckey(std::span<const uint8_t, ml_dsa_87::SecKeyByteLen>(seckey, seckey_len), prepared->key.emplace<2>());
+        break;
+    }
+  }
+
+  if (status != nullptr) {
+    *status = result;
+  }
+  return prepared;
+}
+
+void
+ml_dsa_prepared_seckey_free(ml_dsa_prepared_seckey_t* const prepared)
+{
+  if (prepared == nullptr) {
+    return;
+  }
+
+  std::visit([](auto& key) { wipe(&key, sizeof(key)); }, prepared->key);
+  delete prepared;
+}
+
+int
+ml_dsa_sign_prepared(const ml_dsa_prepared_seckey_t* const prepared,
+                     const uint8_t rnd[ML_DSA_SIGNING_SEED_BYTE_LEN],
+                     const uint8_t* const msg,
+                     const size_t msg_len,
+                     uint8_t* const sig,
+                     const size_t sig_len)
+{
+  const auto _msg = std::span(msg, msg_len);
+  const auto _sig = std::span(sig, sig_len);
+
+  switch (prepared->key.index()) {
+    case 0:
+      return sign_prepared<ml_dsa_runtime::param_set_t::ml_dsa_44>(std::get<0>(prepared->key), rnd, _msg, _sig);
+    case 1:
+      return sign_prepared<ml_dsa_runtime::param_set_t::ml_dsa_65>(std::get<1>(prepared->key), rnd, _msg, _sig);
+    default:
+      return sign_prepared<ml_dsa_runtime::param_set_t::ml_dsa_87>(std::get<2>(prepared->key), rnd, _msg, _sig);
+  }
+}
+
+int
+ml_dsa_sign_batch(const ml_dsa_sign_request_t* const reqs, const size_t n, int* const status)
+{
+  try {
+    std::vector<ml_dsa_runtime::sign_request_t> _reqs;
+    std::vector<size_t> idxs;
+    _reqs.reserve(n);
+    idxs.reserve(n);
+
+    for (size_t i = 0; i < n; i++) {
+      const auto& req = reqs[i];
+      const auto vtable = select_vtable(req.param_set);
+
+      if (vtable == nullptr) {
+        status[i] = ML_DSA_ERR_PARAM_SET;
+      } else if ((req.seckey_len != vtable->seckey_byte_len) || (req.sig_len != vtable->sig_byte_len)) {
+        status[i] = ML_DSA_ERR_LENGTH;
+      } else {
+        _reqs.push_back({ vtable->param_set,
+                          std::span<const uint8_t, ML_DSA_SIGNING_SEED_BYTE_LEN>(req.rnd, ML_DSA_SIGNING_SEED_BYTE_LEN),
+                          std::span(req.seckey, req.seckey_len),
+                          std::span(req.msg, req.msg_len),
+                          std::span(req.sig, req.sig_len) });
+        idxs.push_back(i);
+      }
+    }
+
+    auto signed_ok = std::make_unique<bool[]>(_reqs.size());
+    ml_dsa_runtime::sign_batch(_reqs, std::span(signed_ok.get(), _reqs.size()));
+
+    for (size_t i = 0; i < idxs.size(); i++) {
+      status[idxs[i]] = signed_ok[i] ? ML_DSA_OK : ML_DSA_ERR_LENGTH;
+    }
+  } catch (const std::bad_alloc&) {
+    for (size_t i = 0; i < n; i++) {
+      status[i] = ML_DSA_ERR_ALLOC;
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    if (status[i] != ML_DSA_OK) {
+      return status[i];
+    }
+  }
+  return ML_DSA_OK;
+}
+
+int
+ml_dsa_verify_batch(const ml_dsa_verify_request_t* const reqs, const size_t n, int* const status)
+{
+  try {
+    std::vector<ml_dsa_runtime::verify_request_t> _reqs;
+    std::vector<size_t> idxs;
+    _reqs.reserve(n);
+    idxs.reserve(n);
+
+    for (size_t i = 0; i < n; i++) {
+      const auto& req = reqs[i];
+      const auto vtable = select_vtable(req.param_set);
+
+      if (vtable == nullptr) {
+        status[i] = ML_DSA_ERR_PARAM_SET;
+      } else if ((req.pubkey_len != vtable->pubkey_byte_len) || (req.sig_len != vtable->sig_byte_len)) {
+        status[i] = ML_DSA_ERR_LENGTH;
+      } else {
+        _reqs.push_back({ vtable->param_set, std::span(req.pubkey, req.pubkey_len), std::span(req.msg, req.msg_len), std::span(req.sig, req.sig_len) });
+        idxs.push_back(i);
+      }
+    }
+
+    auto is_valid = std::make_unique<bool[]>(_reqs.size());
+    ml_dsa_runtime::verify_batch(_reqs, std::span(is_valid.get(), _reqs.size()));
+
+    for (size_t i = 0; i < idxs.size(); i++) {
+      status[idxs[i]] = is_valid[i] ? ML_DSA_OK : ML_DSA_ERR_INVALID_SIGNATURE;
+    }
+  } catch (const std::bad_alloc&) {
+    for (size_t i = 0; i < n; i++) {
+      status[i] = ML_DSA_ERR_ALLOC;
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    if (status[i] != ML_DSA_OK) {
+      return status[i];
+    }
+  }
+  return ML_DSA_OK;
+}
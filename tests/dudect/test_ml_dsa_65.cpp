@@ -20,11 +20,11 @@ do_one_computation(uint8_t* const data)
   std::array<ml_dsa_field::zq_t, ml_dsa_65::l * ml_dsa_ntt::N> vec{};
   std::array<ml_dsa_field::zq_t, vec.size()> vec_high{};
   std::array<ml_dsa_field::zq_t, vec.size()> vec_low{};
-  std::array<ml_dsa_field::zq_t, vec_high.size()> vec_hint{};
+  std::array<uint64_t, ml_dsa_65::l * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> vec_hint{};
   std::array<uint8_t, (vec_high.size() * w1bw) / 8> encoded{};
   std::array<ml_dsa_field::zq_t, vec_high.size()> decoded{};
   std::array<uint8_t, ml_dsa_65::ω + ml_dsa_65::l> encoded_hints{};
-  std::array<ml_dsa_field::zq_t, vec.size()> decoded_hints{};
+  std::array<uint64_t, vec_hint.size()> decoded_hints{};
 
   auto seed = std::span<const uint8_t, 2 * SEED_LEN>(data + doff0, doff1 - doff0);
   const uint16_t kappa = (static_cast<uint16_t>(data[doff1 + 1]) << 8) | (static_cast<uint16_t>(data[doff1 + 0]) << 0);
@@ -56,7 +56,7 @@ do_one_computation(uint8_t* const data)
   ret_val ^= static_cast<uint8_t>(z_norm.raw());
 
   ml_dsa_polyvec::make_hint<ml_dsa_65::l, α>(vec, vec_high, vec_hint);
-  ret_val ^= static_cast<uint8_t>(vec_high[0].raw() ^ vec_hint[vec_hint.size() - 1].raw());
+  ret_val ^= static_cast<uint8_t>(vec_high[0].raw() ^ vec_hint[vec_hint.size() - 1]);
 
   const auto count_1 = ml_dsa_polyvec::count_1s<ml_dsa_65::l>(vec_hint);
   ret_val ^= static_cast<uint8_t>(count_1);
@@ -65,7 +65,7 @@ do_one_computation(uint8_t* const data)
   ret_val ^= encoded_hints[0] ^ encoded_hints[encoded_hints.size() - 1];
 
   ml_dsa_bit_packing::decode_hint_bits<ml_dsa_65::l, ml_dsa_65::ω>(encoded_hints, decoded_hints);
-  ret_val ^= static_cast<uint8_t>(decoded_hints[0].raw() ^ decoded_hints[decoded_hints.size() - 1].raw());
+  ret_val ^= static_cast<uint8_t>(decoded_hints[0] ^ decoded_hints[decoded_hints.size() - 1]);
 
   return ret_val;
 }
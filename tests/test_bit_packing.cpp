@@ -1,4 +1,5 @@
 #include "ml_dsa/internals/poly/bit_packing.hpp"
+#include "ml_dsa/internals/poly/polyvec.hpp"
 #include <gtest/gtest.h>
 
 // Check for functional correctness of
@@ -42,15 +43,114 @@ TEST(ML_DSA, PolynomialEncodingDecoding)
   test_encode_decode<20>();
 }
 
-// Generates random hint bit polynomial vector of dimension k x 1, with <= ω coefficients set to 1.
+// Check that packing a polynomial, which has all of its coefficients in centered representation i.e. ∈ [-x, x],
+// produces same bytes as packing x - coeff ∈ [0, 2x], and unpacking recovers the centered polynomial.
+//
+// Note, when 2x doesn't fit in sbw -bits ( e.g. z ∈ [-(γ1-1), γ1] ), coefficients are sampled s.t. x - coeff < 2^sbw.
+template<size_t sbw, uint32_t x>
+static void
+test_encode_decode_centered()
+  requires(ml_dsa_params::check_sbw(sbw))
+{
+  constexpr size_t poly_byte_len = (sbw * ml_dsa_ntt::N) / 8;
+  constexpr ml_dsa_field::zq_t x_cap(x);
+
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> polya{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> polyb{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> polyc{};
+  std::array<uint8_t, poly_byte_len> poly_bytes0{};
+  std::array<uint8_t, poly_byte_len> poly_bytes1{};
+
+  std::random_device rd;
+  std::mt19937_64 gen(rd());
+  std::uniform_int_distribution<uint32_t> dis{ 0, std::min<uint32_t>(2 * x, (1u << sbw) - 1u) };
+
+  for (size_t i = 0; i < ml_dsa_ntt::N; i++) {
+    polya[i] = x_cap - ml_dsa_field::zq_t(dis(gen));
+    polyb[i] = x_cap - polya[i];
+  }
+
+  ml_dsa_bit_packing::encode_centered<sbw, x>(polya, poly_bytes0);
+  ml_dsa_bit_packing::encode<sbw>(polyb, poly_bytes1);
+
+  EXPECT_EQ(poly_bytes0, poly_bytes1);
+
+  ml_dsa_bit_packing::decode_centered<sbw, x>(poly_bytes0, polyc);
+  EXPECT_EQ(polya, polyc);
+}
+
+TEST(ML_DSA, CenteredPolynomialEncodingDecoding)
+{
+  test_encode_decode_centered<3, 2>();
+  test_encode_decode_centered<4, 4>();
+  test_encode_decode_centered<13, 1u << 12>();
+  test_encode_decode_centered<18, 1u << 17>();
+  test_encode_decode_centered<20, 1u << 19>();
+}
+
+// Check that (possibly SIMD backed) encoding/ decoding routines produce exactly same output as scalar packing/ unpacking
+// routines, for both plain and centered representation of coefficients.
+template<size_t sbw, uint32_t x>
+static void
+test_encode_decode_matches_scalar()
+  requires(ml_dsa_params::check_sbw(sbw))
+{
+  constexpr size_t poly_byte_len = (sbw * ml_dsa_ntt::N) / 8;
+  constexpr ml_dsa_field::zq_t x_cap(x);
+
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly0{};
+  std::array<ml_dsa_field::zq_t, ml_dsa_ntt::N> poly1{};
+  std::array<uint8_t, poly_byte_len> bytes{};
+  std::array<uint8_t, poly_byte_len> bytes0{};
+  std::array<uint8_t, poly_byte_len> bytes1{};
+
+  ml_dsa_prng::prng_t<256> prng;
+
+  for (size_t i = 0; i < ml_dsa_ntt::N; i++) {
+    poly[i] = ml_dsa_field::zq_t::random(prng);
+  }
+  prng.read(bytes);
+
+  ml_dsa_bit_packing::encode<sbw>(poly, bytes0);
+  ml_dsa_bit_packing::pack<sbw>([&](const size_t i) -> uint32_t { return poly[i].raw(); }, bytes1);
+  EXPECT_EQ(bytes0, bytes1);
+
+  ml_dsa_bit_packing::encode_centered<sbw, x>(poly, bytes0);
+  ml_dsa_bit_packing::pack<sbw>([&](const size_t i) -> uint32_t { return (x_cap - poly[i]).raw(); }, bytes1);
+  EXPECT_EQ(bytes0, bytes1);
+
+  ml_dsa_bit_packing::decode<sbw>(bytes, poly0);
+  ml_dsa_bit_packing::unpack<sbw>(bytes, [&](const size_t i, const uint32_t coeff) { poly1[i] = ml_dsa_field::zq_t(coeff); });
+  EXPECT_EQ(poly0, poly1);
+
+  ml_dsa_bit_packing::decode_centered<sbw, x>(bytes, poly0);
+  ml_dsa_bit_packing::unpack<sbw>(bytes, [&](const size_t i, const uint32_t coeff) { poly1[i] = x_cap - ml_dsa_field::zq_t(coeff); });
+  EXPECT_EQ(poly0, poly1);
+}
+
+TEST(ML_DSA, PolynomialEncodingDecodingMatchesScalar)
+{
+  test_encode_decode_matches_scalar<3, 2>();
+  test_encode_decode_matches_scalar<4, 4>();
+  test_encode_decode_matches_scalar<5, 9>();
+  test_encode_decode_matches_scalar<6, 0>();
+  test_encode_decode_matches_scalar<10, 0>();
+  test_encode_decode_matches_scalar<13, 1u << 12>();
+  test_encode_decode_matches_scalar<18, 1u << 17>();
+  test_encode_decode_matches_scalar<20, 1u << 19>();
+  test_encode_decode_matches_scalar<23, 1u << 22>();
+}
+
+// Generates random hint bitset vector of dimension k x 1, with <= ω bits set.
 template<size_t k, size_t ω>
 static void
-generate_random_hint_bits(std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> poly)
+generate_random_hint_bits(std::span<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> hint)
 {
-  std::fill(poly.begin(), poly.end(), ml_dsa_field::zq_t::zero());
+  std::fill(hint.begin(), hint.end(), 0ul);
 
   constexpr size_t frm = 0;
-  constexpr size_t to = poly.size() - 1;
+  constexpr size_t to = k * ml_dsa_ntt::N - 1;
 
   std::random_device rd;
   std::mt19937_64 gen(rd());
@@ -58,27 +158,29 @@ generate_random_hint_bits(std::span<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> poly)
 
   for (size_t i = 0; i < ω; i++) {
     const size_t idx = dis(gen);
-    poly[idx] = ml_dsa_field::zq_t::one();
+    hint[idx / 64] |= 1ul << (idx % 64);
   }
 }
 
-// Test functional correctness of encoding and decoding of hint bit polynomial vector.
+// Test functional correctness of encoding and decoding of hint bitset vector.
 template<size_t k, size_t ω>
 static void
 test_encode_decode_hint_bits()
 {
   constexpr size_t hint_byte_len = ω + k;
 
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h0{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h1{};
-  std::array<ml_dsa_field::zq_t, k * ml_dsa_ntt::N> h2{};
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> h0{};
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> h1{};
+  std::array<uint64_t, k * ml_dsa_bit_packing::HINT_WORDS_PER_POLY> h2{};
 
   std::array<uint8_t, hint_byte_len> hint_poly_bytes0{};
   std::array<uint8_t, hint_byte_len> hint_poly_bytes1{};
 
   generate_random_hint_bits<k, ω>(h0);
+  EXPECT_LE(ml_dsa_polyvec::count_1s<k>(h0), ω);
 
   ml_dsa_bit_packing::encode_hint_bits<k, ω>(h0, hint_poly_bytes0);
+  EXPECT_EQ(hint_poly_bytes0[hint_byte_len - 1], ml_dsa_polyvec::count_1s<k>(h0));
 
   std::copy(hint_poly_bytes0.begin(), hint_poly_bytes0.end(), hint_poly_bytes1.begin());
   hint_poly_bytes1[hint_byte_len - 1] = ~hint_poly_bytes1[hint_byte_len - 1];
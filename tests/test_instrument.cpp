@@ -0,0 +1,62 @@
+#define ML_DSA_INSTRUMENT
+#include "ml_dsa/ml_dsa_65.hpp"
+#include "test_helper.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+
+// Test that, when compiled with instrumentation enabled, keygen, sign and verify account for calls, stages, iterations of
+// rejection sampling loop and rejections, in statistics of the calling thread, without changing their results.
+//
+// Internal routines are invoked, instead of public API of `ml_dsa_65` namespace, as those have internal linkage, so
+// that this translation unit gets its own instrumented copy of them.
+TEST(ML_DSA, InstrumentationStatistics)
+{
+  using stage_t = ml_dsa_instrument::stage_t;
+  using op_t = ml_dsa_instrument::op_t;
+  using namespace ml_dsa_65;
+
+  constexpr size_t ROUNDS = 8;
+
+  std::array<uint8_t, ml_dsa_65::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_65::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_65::PubKeyByteLen> pkey{};
+  std::array<uint8_t, ml_dsa_65::SecKeyByteLen> skey{};
+  std::array<uint8_t, ml_dsa_65::SigByteLen> sig{};
+  std::array<uint8_t, 32> msg{};
+
+  ml_dsa_prng::prng_t<256> prng;
+  ml_dsa_instrument::reset_stats();
+
+  for (size_t i = 0; i < ROUNDS; i++) {
+    prng.read(seed);
+    prng.read(rnd);
+    prng.read(msg);
+
+    ml_dsa::keygen<k, l, d, η>(seed, pkey, skey);
+    ml_dsa::sign<k, l, d, η, γ1, γ2, τ, β, ω, λ>(rnd, skey, msg, sig);
+    EXPECT_TRUE((ml_dsa::verify<k, l, d, γ1, γ2, τ, β, ω, λ>(pkey, msg, sig)));
+  }
+
+  const auto& stats = ml_dsa_instrument::stats();
+
+  EXPECT_EQ(stats.calls[static_cast<size_t>(op_t::keygen)], ROUNDS);
+  EXPECT_EQ(stats.calls[static_cast<size_t>(op_t::sign)], ROUNDS);
+  EXPECT_EQ(stats.calls[static_cast<size_t>(op_t::verify)], ROUNDS);
+
+  // Each signing call is accepted in its last iteration, all other iterations are rejected by exactly one bound.
+  const uint64_t rejections = std::accumulate(stats.rejections.begin(), stats.rejections.end(), uint64_t(0));
+  EXPECT_GE(stats.sign_iterations, ROUNDS);
+  EXPECT_EQ(stats.sign_iterations, ROUNDS + rejections);
+
+  // Matrix A is expanded once in each of keygen, secret key preparation and verify.
+  EXPECT_EQ(stats.stage_calls[static_cast<size_t>(stage_t::expand_a)], 3 * ROUNDS);
+  EXPECT_EQ(stats.stage_calls[static_cast<size_t>(stage_t::expand_mask)], stats.sign_iterations);
+
+  for (size_t i = 0; i < ml_dsa_instrument::STAGE_CNT; i++) {
+    EXPECT_GT(stats.stage_calls[i], 0u) << ml_dsa_instrument::stage_name(static_cast<stage_t>(i));
+    EXPECT_GT(stats.cycles[i], 0u) << ml_dsa_instrument::stage_name(static_cast<stage_t>(i));
+  }
+
+  ml_dsa_instrument::reset_stats();
+  EXPECT_EQ(ml_dsa_instrument::stats().sign_iterations, 0u);
+}
@@ -1,7 +1,9 @@
 #include "ml_dsa/ml_dsa_44.hpp"
 #include "test_helper.hpp"
+#include <algorithm>
 #include <cassert>
 #include <gtest/gtest.h>
+#include <memory>
 
 // Test functional correctness of ML-DSA-44 signature scheme, by
 //
@@ -37,6 +39,36 @@ test_ml_dsa_44_signing(const size_t mlen)
   ml_dsa_44::keygen(seed, pkey, skey);       // Generate a valid ML-DSA-44 keypair
   ml_dsa_44::sign(rnd, skey, msg_span, sig); // Sign a random message with ML-DSA-44 secret ket
 
+  // Signing with prepared secret key must produce the very same signature
+  auto prepared = std::make_unique<ml_dsa_44::prepared_seckey_t>();
+  std::array<uint8_t, ml_dsa_44::SigByteLen> sig_prepared{};
+
+  ml_dsa_44::prepare_seckey(skey, *prepared);
+  ml_dsa_44::sign(rnd, *prepared, msg_span, sig_prepared);
+
+  EXPECT_EQ(sig, sig_prepared);
+
+  // So must signing with message representative μ, computed by a party, not holding the secret key
+  std::array<uint8_t, ml_dsa_44::MuByteLen> mu{};
+  std::array<uint8_t, ml_dsa_44::SigByteLen> sig_mu{};
+
+  ml_dsa::compute_mu(prepared->tr, msg_span, mu);
+  ml_dsa_44::sign_mu(rnd, *prepared, mu, sig_mu);
+
+  EXPECT_EQ(sig, sig_mu);
+
+  // So must signing with SHAKE256 state, after absorbing tr and first half of the message, only absorbing second half
+  ml_dsa::mu_prefix_t prefix_state{};
+  ml_dsa::mu_prefix_t other_key_prefix_state{};
+  std::array<uint8_t, ml_dsa_44::SigByteLen> sig_prefix{};
+
+  ml_dsa::absorb_prefix(prepared->tr, msg_span.first(mlen / 2), prefix_state);
+  ml_dsa::absorb_prefix(std::array<uint8_t, 64>{}, msg_span.first(mlen / 2), other_key_prefix_state);
+
+  EXPECT_TRUE(ml_dsa_44::sign(rnd, *prepared, prefix_state, msg_span.subspan(mlen / 2), sig_prefix));
+  EXPECT_EQ(sig, sig_prefix);
+  EXPECT_FALSE(ml_dsa_44::sign(rnd, *prepared, other_key_prefix_state, msg_span.subspan(mlen / 2), sig_prefix));
+
   std::copy(sig.begin(), sig.end(), sig_copy.begin());
   std::copy(pkey.begin(), pkey.end(), pkey_copy.begin());
   std::copy(msg_span.begin(), msg_span.end(), msg_copy_span.begin());
@@ -49,6 +81,70 @@ test_ml_dsa_44_signing(const size_t mlen)
   EXPECT_FALSE(ml_dsa_44::verify(pkey, msg_span, sig_copy)); // pkey is good, msg is good, sig is bad
   EXPECT_FALSE(ml_dsa_44::verify(pkey_copy, msg, sig));      // pkey is bad, msg is good, sig is good
   EXPECT_FALSE(ml_dsa_44::verify(pkey, msg_copy, sig));      // pkey is good, msg is bad, sig is good
+
+  // Verifying with prepared public key, be it with message or with μ, must agree with verifying with the public key
+  auto prepared_pkey = std::make_unique<ml_dsa_44::prepared_pubkey_t>();
+  ml_dsa_44::prepare_pubkey(pkey, *prepared_pkey);
+
+  EXPECT_EQ(prepared_pkey->tr, prepared->tr);
+  EXPECT_TRUE(ml_dsa_44::verify(*prepared_pkey, msg_span, sig));
+  EXPECT_TRUE(ml_dsa_44::verify_mu(*prepared_pkey, mu, sig));
+  EXPECT_FALSE(ml_dsa_44::verify(*prepared_pkey, msg_span, sig_copy));
+  EXPECT_FALSE(ml_dsa_44::verify(*prepared_pkey, msg_copy, sig));
+  EXPECT_TRUE(ml_dsa_44::verify(*prepared_pkey, prefix_state, msg_span.subspan(mlen / 2), sig));
+  EXPECT_FALSE(ml_dsa_44::verify(*prepared_pkey, prefix_state, msg_span.subspan(mlen / 2), sig_copy));
+  EXPECT_FALSE(ml_dsa_44::verify(*prepared_pkey, other_key_prefix_state, msg_span.subspan(mlen / 2), sig));
+
+  // So must verifying with packed prepared public key
+  auto packed_pkey = std::make_unique<ml_dsa_44::packed_prepared_pubkey_t>();
+  ml_dsa_44::prepare_pubkey(pkey, *packed_pkey);
+
+  EXPECT_EQ(packed_pkey->tr, prepared->tr);
+  EXPECT_TRUE(ml_dsa_44::verify(*packed_pkey, msg_span, sig));
+  EXPECT_TRUE(ml_dsa_44::verify_mu(*packed_pkey, mu, sig));
+  EXPECT_FALSE(ml_dsa_44::verify(*packed_pkey, msg_span, sig_copy));
+  EXPECT_FALSE(ml_dsa_44::verify(*packed_pkey, msg_copy, sig));
+  EXPECT_TRUE(ml_dsa_44::verify(*packed_pkey, prefix_state, msg_span.subspan(mlen / 2), sig));
+
+  // Signature bound to a context string is the signature over formatted message 0 || len(ctx) || ctx || M, however
+  // it's computed, while it only verifies under the same context string
+  std::array<uint8_t, 16> ctx{};
+  std::array<uint8_t, ml_dsa_44::SigByteLen> sig_ctx{};
+  std::array<uint8_t, ml_dsa_44::SigByteLen> sig_formatted{};
+  std::vector<uint8_t> formatted{ 0, static_cast<uint8_t>(ctx.size()) };
+
+  prng.read(ctx);
+  formatted.insert(formatted.end(), ctx.begin(), ctx.end());
+  formatted.insert(formatted.end(), msg.begin(), msg.end());
+
+  EXPECT_TRUE(ml_dsa_44::sign(rnd, skey, ctx, msg_span, sig_ctx));
+  ml_dsa_44::sign(rnd, skey, formatted, sig_formatted);
+  EXPECT_EQ(sig_ctx, sig_formatted);
+
+  EXPECT_TRUE(ml_dsa_44::sign(rnd, *prepared, ctx, msg_span, sig_prepared));
+  EXPECT_EQ(sig_ctx, sig_prepared);
+
+  EXPECT_TRUE(ml_dsa::compute_mu(prepared->tr, ctx, msg_span, mu));
+  ml_dsa_44::sign_mu(rnd, *prepared, mu, sig_mu);
+  EXPECT_EQ(sig_ctx, sig_mu);
+
+  EXPECT_TRUE(ml_dsa::absorb_prefix(prepared->tr, ctx, msg_span.first(mlen / 2), prefix_state));
+  EXPECT_TRUE(ml_dsa_44::sign(rnd, *prepared, prefix_state, msg_span.subspan(mlen / 2), sig_prefix));
+  EXPECT_EQ(sig_ctx, sig_prefix);
+
+  EXPECT_TRUE(ml_dsa_44::verify(pkey, ctx, msg_span, sig_ctx));
+  EXPECT_TRUE(ml_dsa_44::verify(*prepared_pkey, ctx, msg_span, sig_ctx));
+  EXPECT_TRUE(ml_dsa_44::verify(*packed_pkey, ctx, msg_span, sig_ctx));
+  EXPECT_TRUE(ml_dsa_44::verify(*prepared_pkey, prefix_state, msg_span.subspan(mlen / 2), sig_ctx));
+  EXPECT_FALSE(ml_dsa_44::verify(pkey, msg_span, sig_ctx));
+  EXPECT_FALSE(ml_dsa_44::verify(pkey, std::span(ctx).first(ctx.size() - 1), msg_span, sig_ctx));
+  EXPECT_FALSE(ml_dsa_44::verify(pkey, ctx, msg_copy_span, sig_ctx));
+
+  // Context string can't be longer than 255 -bytes
+  std::array<uint8_t, ml_dsa_44::MaxCtxByteLen + 1> long_ctx{};
+  EXPECT_FALSE(ml_dsa_44::sign(rnd, skey, long_ctx, msg_span, sig_ctx));
+  EXPECT_FALSE(ml_dsa_44::verify(pkey, long_ctx, msg_span, sig_ctx));
+  EXPECT_FALSE(ml_dsa::absorb_prefix(prepared->tr, long_ctx, msg_span, prefix_state));
 }
 
 TEST(ML_DSA, ML_DSA_44_KeygenSignVerifyFlow)
@@ -57,3 +153,151 @@ TEST(ML_DSA, ML_DSA_44_KeygenSignVerifyFlow)
     test_ml_dsa_44_signing(mlen);
   }
 }
+
+// Test HashML-DSA variant of ML-DSA-44, using given pre-hash function, by signing streaming digest of a random
+// message, with both secret key and prepared secret key, and verifying it with all kinds of public keys, while
+// signature must not verify under another context string, another pre-hash function or a mutated digest.
+template<ml_dsa_prehash::hash_t hash>
+static void
+test_ml_dsa_44_prehash(const size_t mlen)
+{
+  std::array<uint8_t, ml_dsa_44::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_44::PubKeyByteLen> pkey{};
+  std::array<uint8_t, ml_dsa_44::SecKeyByteLen> skey{};
+  std::array<uint8_t, ml_dsa_44::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_44::SigByteLen> sig{};
+  std::array<uint8_t, ml_dsa_44::SigByteLen> sig_prepared{};
+  std::array<uint8_t, ml_dsa_prehash::DIGEST_BYTE_LEN<hash>> digest{};
+  std::array<uint8_t, 8> ctx{};
+  std::vector<uint8_t> msg(mlen, 0);
+
+  ml_dsa_prng::prng_t<128> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(ctx);
+  prng.read(msg);
+
+  ml_dsa_44::keygen(seed, pkey, skey);
+
+  // Digest the message, in chunks of 7 -bytes
+  ml_dsa_prehash::prehasher_t<hash> prehasher;
+  for (size_t off = 0; off < mlen; off += 7) {
+    prehasher.absorb(std::span(msg).subspan(off, std::min<size_t>(7, mlen - off)));
+  }
+  prehasher.digest(digest);
+
+  auto prepared_skey = std::make_unique<ml_dsa_44::prepared_seckey_t>();
+  ml_dsa_44::prepare_seckey(skey, *prepared_skey);
+
+  EXPECT_TRUE(ml_dsa_44::sign_prehash(rnd, skey, ctx, hash, digest, sig));
+  EXPECT_TRUE(ml_dsa_44::sign_prehash(rnd, *prepared_skey, ctx, hash, digest, sig_prepared));
+  EXPECT_EQ(sig, sig_prepared);
+
+  auto prepared_pkey = std::make_unique<ml_dsa_44::prepared_pubkey_t>();
+  auto packed_pkey = std::make_unique<ml_dsa_44::packed_prepared_pubkey_t>();
+  ml_dsa_44::prepare_pubkey(pkey, *prepared_pkey);
+  ml_dsa_44::prepare_pubkey(pkey, *packed_pkey);
+
+  EXPECT_TRUE(ml_dsa_44::verify_prehash(pkey, ctx, hash, digest, sig));
+  EXPECT_TRUE(ml_dsa_44::verify_prehash(*prepared_pkey, ctx, hash, digest, sig));
+  EXPECT_TRUE(ml_dsa_44::verify_prehash(*packed_pkey, ctx, hash, digest, sig));
+  EXPECT_FALSE(ml_dsa_44::verify_prehash(pkey, std::span(ctx).first(ctx.size() - 1), hash, digest, sig));
+
+  // Same digest length, another object identifier
+  constexpr auto other_hash = (hash == ml_dsa_prehash::hash_t::sha3_256)   ? ml_dsa_prehash::hash_t::shake128
+                              : (hash == ml_dsa_prehash::hash_t::shake128) ? ml_dsa_prehash::hash_t::sha3_256
+                              : (hash == ml_dsa_prehash::hash_t::sha3_512) ? ml_dsa_prehash::hash_t::shake256
+                                                                           : ml_dsa_prehash::hash_t::sha3_512;
+  EXPECT_FALSE(ml_dsa_44::verify_prehash(pkey, ctx, other_hash, digest, sig));
+
+  auto digest_copy = digest;
+  ml_dsa_test_helper::random_bit_flip(digest_copy);
+  EXPECT_FALSE(ml_dsa_44::verify_prehash(pkey, ctx, hash, digest_copy, sig));
+
+  // Malformed context string or digest is rejected
+  std::array<uint8_t, ml_dsa_44::MaxCtxByteLen + 1> long_ctx{};
+  EXPECT_FALSE(ml_dsa_44::sign_prehash(rnd, skey, long_ctx, hash, digest, sig));
+  EXPECT_FALSE(ml_dsa_44::sign_prehash(rnd, skey, ctx, hash, std::span(digest).first(digest.size() - 1), sig));
+  EXPECT_FALSE(ml_dsa_44::verify_prehash(pkey, long_ctx, hash, digest, sig_prepared));
+}
+
+TEST(ML_DSA, ML_DSA_44_HashMLDSASignVerify)
+{
+  for (size_t mlen = 0; mlen < 200; mlen += 33) {
+    test_ml_dsa_44_prehash<ml_dsa_prehash::hash_t::sha3_256>(mlen);
+    test_ml_dsa_44_prehash<ml_dsa_prehash::hash_t::sha3_512>(mlen);
+    test_ml_dsa_44_prehash<ml_dsa_prehash::hash_t::shake128>(mlen);
+    test_ml_dsa_44_prehash<ml_dsa_prehash::hash_t::shake256>(mlen);
+  }
+}
+
+// Test that verifying many signatures under a single ML-DSA-44 public key, in batches, agrees with verifying each one of
+// them on its own, for any number of signatures, with invalid ones placed anywhere in and out of full batches.
+TEST(ML_DSA, ML_DSA_44_VerifyManyUnderSamePublicKey)
+{
+  constexpr size_t SIG_CNT = 11;
+
+  std::array<uint8_t, ml_dsa_44::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_44::PubKeyByteLen> pkey{};
+  std::array<uint8_t, ml_dsa_44::SecKeyByteLen> skey{};
+  std::vector<std::vector<uint8_t>> msgs(SIG_CNT);
+  std::vector<std::array<uint8_t, ml_dsa_44::SigByteLen>> sigs(SIG_CNT);
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  ml_dsa_44::keygen(seed, pkey, skey);
+
+  for (size_t i = 0; i < SIG_CNT; i++) {
+    std::array<uint8_t, ml_dsa_44::SigningSeedByteLen> rnd{};
+    prng.read(rnd);
+
+    msgs[i].resize(i + 1);
+    prng.read(msgs[i]);
+
+    ml_dsa_44::sign(rnd, skey, msgs[i], sigs[i]);
+  }
+
+  auto prepared = std::make_unique<ml_dsa_44::prepared_pubkey_t>();
+  auto packed = std::make_unique<ml_dsa_44::packed_prepared_pubkey_t>();
+
+  ml_dsa_44::prepare_pubkey(pkey, *prepared);
+  ml_dsa_44::prepare_pubkey(pkey, *packed);
+
+  for (size_t n = 0; n <= SIG_CNT; n++) {
+    std::vector<std::span<const uint8_t>> msg_spans(msgs.begin(), msgs.begin() + n);
+    std::vector<std::span<const uint8_t, ml_dsa_44::SigByteLen>> sig_spans(sigs.begin(), sigs.begin() + n);
+    auto status = std::make_unique<bool[]>(n);
+
+    EXPECT_TRUE(ml_dsa_44::verify_many(pkey, msg_spans, sig_spans, std::span(status.get(), n)));
+    EXPECT_TRUE(std::all_of(status.get(), status.get() + n, [](bool v) { return v; }));
+  }
+
+  // Corrupt a signature within the first batch, a signature within the second one, a signature out of full batches and
+  // the message of another one.
+  auto bad_sigs = sigs;
+  ml_dsa_test_helper::random_bit_flip(bad_sigs[1]);
+  ml_dsa_test_helper::random_bit_flip(bad_sigs[6]);
+  ml_dsa_test_helper::random_bit_flip(bad_sigs[9]);
+  std::swap(bad_sigs[4], bad_sigs[5]);
+
+  std::vector<std::span<const uint8_t>> msg_spans(msgs.begin(), msgs.end());
+  std::vector<std::span<const uint8_t, ml_dsa_44::SigByteLen>> sig_spans(bad_sigs.begin(), bad_sigs.end());
+
+  std::array<bool, SIG_CNT> expected{};
+  for (size_t i = 0; i < SIG_CNT; i++) {
+    expected[i] = ml_dsa_44::verify(pkey, msgs[i], bad_sigs[i]);
+  }
+
+  std::array<bool, SIG_CNT> status{};
+  std::array<bool, SIG_CNT> status_prepared{};
+  std::array<bool, SIG_CNT> status_packed{};
+
+  EXPECT_FALSE(ml_dsa_44::verify_many(pkey, msg_spans, sig_spans, status));
+  EXPECT_FALSE(ml_dsa_44::verify_many(*prepared, msg_spans, sig_spans, status_prepared));
+  EXPECT_FALSE(ml_dsa_44::verify_many(*packed, msg_spans, sig_spans, status_packed));
+
+  EXPECT_EQ(std::count(expected.begin(), expected.end(), true), static_cast<ptrdiff_t>(SIG_CNT - 5));
+  EXPECT_EQ(status, expected);
+  EXPECT_EQ(status_prepared, expected);
+  EXPECT_EQ(status_packed, expected);
+}
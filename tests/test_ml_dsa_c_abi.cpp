@@ -0,0 +1,119 @@
+#include "ml_dsa/ml_dsa.h"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include "test_helper.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+// Test that C ABI of ML-DSA library produces same keypairs and signatures as C++ API, for all parameter sets, while
+// reporting mismatching byte lengths and invalid signatures using respective status codes.
+TEST(ML_DSA, C_ABI_KeygenSignVerify)
+{
+  for (const auto param_set : { ML_DSA_44, ML_DSA_65, ML_DSA_87 }) {
+    const auto& vtable = ml_dsa_runtime::select(static_cast<ml_dsa_runtime::param_set_t>(param_set));
+
+    EXPECT_EQ(ml_dsa_pubkey_byte_len(param_set), vtable.pubkey_byte_len);
+    EXPECT_EQ(ml_dsa_seckey_byte_len(param_set), vtable.seckey_byte_len);
+    EXPECT_EQ(ml_dsa_sig_byte_len(param_set), vtable.sig_byte_len);
+
+    std::array<uint8_t, ML_DSA_KEYGEN_SEED_BYTE_LEN> seed{};
+    std::array<uint8_t, ML_DSA_SIGNING_SEED_BYTE_LEN> rnd{};
+    std::array<uint8_t, 48> msg{};
+
+    ml_dsa_prng::prng_t<256> prng;
+    prng.read(seed);
+    prng.read(rnd);
+    prng.read(msg);
+
+    std::vector<uint8_t> pkey(vtable.pubkey_byte_len), expected_pkey(vtable.pubkey_byte_len);
+    std::vector<uint8_t> skey(vtable.seckey_byte_len), expected_skey(vtable.seckey_byte_len);
+    std::vector<uint8_t> sig(vtable.sig_byte_len), expected_sig(vtable.sig_byte_len), sig_prepared(vtable.sig_byte_len);
+
+    EXPECT_TRUE(vtable.keygen(seed, expected_pkey, expected_skey));
+    EXPECT_TRUE(vtable.sign(rnd, expected_skey, msg, expected_sig));
+
+    EXPECT_EQ(ml_dsa_keygen(param_set, seed.data(), pkey.data(), pkey.size(), skey.data(), skey.size()), ML_DSA_OK);
+    EXPECT_EQ(ml_dsa_sign(param_set, rnd.data(), skey.data(), skey.size(), msg.data(), msg.size(), sig.data(), sig.size()), ML_DSA_OK);
+
+    EXPECT_EQ(pkey, expected_pkey);
+    EXPECT_EQ(skey, expected_skey);
+    EXPECT_EQ(sig, expected_sig);
+
+    int status = ML_DSA_ERR_ALLOC;
+    auto prepared = ml_dsa_prepare_seckey(param_set, skey.data(), skey.size(), &status);
+    EXPECT_EQ(status, ML_DSA_OK);
+    ASSERT_NE(prepared, nullptr);
+
+    EXPECT_EQ(ml_dsa_sign_prepared(prepared, rnd.data(), msg.data(), msg.size(), sig_prepared.data(), sig_prepared.size()), ML_DSA_OK);
+    EXPECT_EQ(ml_dsa_sign_prepared(prepared, rnd.data(), msg.data(), msg.size(), sig_prepared.data(), sig_prepared.size() - 1), ML_DSA_ERR_LENGTH);
+    EXPECT_EQ(sig_prepared, expected_sig);
+    ml_dsa_prepared_seckey_free(prepared);
+
+    EXPECT_EQ(ml_dsa_verify(param_set, pkey.data(), pkey.size(), msg.data(), msg.size(), sig.data(), sig.size()), ML_DSA_OK);
+    EXPECT_EQ(ml_dsa_verify(param_set, pkey.data(), pkey.size() - 1, msg.data(), msg.size(), sig.data(), sig.size()), ML_DSA_ERR_LENGTH);
+    EXPECT_EQ(ml_dsa_sign(param_set, rnd.data(), skey.data(), skey.size(), msg.data(), msg.size(), sig.data(), sig.size() + 1), ML_DSA_ERR_LENGTH);
+
+    ml_dsa_test_helper::random_bit_flip(std::span(sig));
+    EXPECT_EQ(ml_dsa_verify(param_set, pkey.data(), pkey.size(), msg.data(), msg.size(), sig.data(), sig.size()), ML_DSA_ERR_INVALID_SIGNATURE);
+  }
+
+  const auto unknown = static_cast<ml_dsa_param_set_t>(3);
+  std::array<uint8_t, ML_DSA_KEYGEN_SEED_BYTE_LEN> seed{};
+  int status = ML_DSA_OK;
+
+  EXPECT_EQ(ml_dsa_pubkey_byte_len(unknown), 0u);
+  EXPECT_EQ(ml_dsa_keygen(unknown, seed.data(), nullptr, 0, nullptr, 0), ML_DSA_ERR_PARAM_SET);
+  EXPECT_EQ(ml_dsa_prepare_seckey(unknown, nullptr, 0, &status), nullptr);
+  EXPECT_EQ(status, ML_DSA_ERR_PARAM_SET);
+}
+
+// Test that batch routines of C ABI report status of each request, for requests of mixed parameter sets.
+TEST(ML_DSA, C_ABI_BatchSignVerify)
+{
+  constexpr std::array PARAM_SETS = { ML_DSA_87, ML_DSA_44, ML_DSA_65, ML_DSA_44 };
+
+  std::array<uint8_t, ML_DSA_KEYGEN_SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, ML_DSA_SIGNING_SEED_BYTE_LEN> rnd{};
+  std::array<uint8_t, 16> msg{};
+
+  ml_dsa_prng::prng_t<256> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg);
+
+  std::array<std::vector<uint8_t>, PARAM_SETS.size()> pkeys{}, skeys{}, sigs{};
+  std::vector<ml_dsa_sign_request_t> sign_reqs;
+
+  for (size_t i = 0; i < PARAM_SETS.size(); i++) {
+    pkeys[i].resize(ml_dsa_pubkey_byte_len(PARAM_SETS[i]));
+    skeys[i].resize(ml_dsa_seckey_byte_len(PARAM_SETS[i]));
+    sigs[i].resize(ml_dsa_sig_byte_len(PARAM_SETS[i]));
+
+    EXPECT_EQ(ml_dsa_keygen(PARAM_SETS[i], seed.data(), pkeys[i].data(), pkeys[i].size(), skeys[i].data(), skeys[i].size()), ML_DSA_OK);
+    sign_reqs.push_back({ PARAM_SETS[i], rnd.data(), skeys[i].data(), skeys[i].size(), msg.data(), msg.size(), sigs[i].data(), sigs[i].size() });
+  }
+
+  // Secret key of mismatching parameter set must be rejected.
+  std::vector<uint8_t> bad_sig(ml_dsa_sig_byte_len(ML_DSA_65));
+  sign_reqs.push_back({ ML_DSA_65, rnd.data(), skeys[0].data(), skeys[0].size(), msg.data(), msg.size(), bad_sig.data(), bad_sig.size() });
+
+  std::vector<int> sign_status(sign_reqs.size(), ML_DSA_ERR_ALLOC);
+  EXPECT_EQ(ml_dsa_sign_batch(sign_reqs.data(), sign_reqs.size(), sign_status.data()), ML_DSA_ERR_LENGTH);
+
+  for (size_t i = 0; i < PARAM_SETS.size(); i++) {
+    EXPECT_EQ(sign_status[i], ML_DSA_OK);
+  }
+  EXPECT_EQ(sign_status.back(), ML_DSA_ERR_LENGTH);
+
+  std::vector<ml_dsa_verify_request_t> verify_reqs;
+  for (size_t i = 0; i < PARAM_SETS.size(); i++) {
+    verify_reqs.push_back({ PARAM_SETS[i], pkeys[i].data(), pkeys[i].size(), msg.data(), msg.size(), sigs[i].data(), sigs[i].size() });
+  }
+
+  std::vector<int> verify_status(verify_reqs.size(), ML_DSA_ERR_ALLOC);
+  EXPECT_EQ(ml_dsa_verify_batch(verify_reqs.data(), verify_reqs.size(), verify_status.data()), ML_DSA_OK);
+
+  ml_dsa_test_helper::random_bit_flip(std::span(sigs[2]));
+  EXPECT_EQ(ml_dsa_verify_batch(verify_reqs.data(), verify_reqs.size(), verify_status.data()), ML_DSA_ERR_INVALID_SIGNATURE);
+  EXPECT_EQ(verify_status[2], ML_DSA_ERR_INVALID_SIGNATURE);
+  EXPECT_EQ(verify_status[3], ML_DSA_OK);
+}
@@ -0,0 +1,119 @@
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include "test_helper.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+// Test that runtime selected parameter set API produces the very same keypairs and signatures as respective compile-time
+// API, while rejecting byte spans of mismatching length.
+TEST(ML_DSA, RuntimeParameterSetSelection)
+{
+  std::array<uint8_t, ml_dsa_runtime::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_runtime::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, 32> msg{};
+
+  ml_dsa_prng::prng_t<256> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg);
+
+  std::array<uint8_t, ml_dsa_65::PubKeyByteLen> expected_pkey{};
+  std::array<uint8_t, ml_dsa_65::SecKeyByteLen> expected_skey{};
+  std::array<uint8_t, ml_dsa_65::SigByteLen> expected_sig{};
+
+  ml_dsa_65::keygen(seed, expected_pkey, expected_skey);
+  ml_dsa_65::sign(rnd, expected_skey, msg, expected_sig);
+
+  const auto& vtable = ml_dsa_runtime::select(ml_dsa_runtime::param_set_t::ml_dsa_65);
+  EXPECT_EQ(vtable.pubkey_byte_len, ml_dsa_65::PubKeyByteLen);
+  EXPECT_EQ(vtable.seckey_byte_len, ml_dsa_65::SecKeyByteLen);
+  EXPECT_EQ(vtable.sig_byte_len, ml_dsa_65::SigByteLen);
+
+  std::vector<uint8_t> pkey(vtable.pubkey_byte_len);
+  std::vector<uint8_t> skey(vtable.seckey_byte_len);
+  std::vector<uint8_t> sig(vtable.sig_byte_len);
+
+  EXPECT_TRUE(ml_dsa_runtime::keygen(ml_dsa_runtime::param_set_t::ml_dsa_65, seed, pkey, skey));
+  EXPECT_TRUE(ml_dsa_runtime::sign(ml_dsa_runtime::param_set_t::ml_dsa_65, rnd, skey, msg, sig));
+
+  EXPECT_TRUE(std::ranges::equal(pkey, expected_pkey));
+  EXPECT_TRUE(std::ranges::equal(skey, expected_skey));
+  EXPECT_TRUE(std::ranges::equal(sig, expected_sig));
+
+  EXPECT_TRUE(ml_dsa_runtime::verify(ml_dsa_runtime::param_set_t::ml_dsa_65, pkey, msg, sig));
+  EXPECT_FALSE(ml_dsa_runtime::verify(ml_dsa_runtime::param_set_t::ml_dsa_44, pkey, msg, sig));
+  EXPECT_FALSE(ml_dsa_runtime::verify(ml_dsa_runtime::param_set_t::ml_dsa_87, pkey, msg, sig));
+  EXPECT_FALSE(ml_dsa_runtime::verify(static_cast<ml_dsa_runtime::param_set_t>(3), pkey, msg, sig));
+  EXPECT_FALSE(ml_dsa_runtime::sign(ml_dsa_runtime::param_set_t::ml_dsa_44, rnd, skey, msg, sig));
+}
+
+// Test that batch signing and verification of requests of mixed parameter sets produce same results as signing and
+// verifying each request on its own.
+TEST(ML_DSA, RuntimeBatchSignVerify)
+{
+  constexpr size_t REQ_CNT = 15;
+  constexpr std::array PARAM_SETS = { ml_dsa_runtime::param_set_t::ml_dsa_44, ml_dsa_runtime::param_set_t::ml_dsa_65, ml_dsa_runtime::param_set_t::ml_dsa_87 };
+
+  ml_dsa_prng::prng_t<256> prng;
+
+  std::array<std::vector<uint8_t>, PARAM_SETS.size()> pkeys{}, skeys{};
+  for (size_t i = 0; i < PARAM_SETS.size(); i++) {
+    const auto& vtable = ml_dsa_runtime::select(PARAM_SETS[i]);
+
+    std::array<uint8_t, ml_dsa_runtime::KeygenSeedByteLen> seed{};
+    prng.read(seed);
+
+    pkeys[i].resize(vtable.pubkey_byte_len);
+    skeys[i].resize(vtable.seckey_byte_len);
+    EXPECT_TRUE(vtable.keygen(seed, pkeys[i], skeys[i]));
+  }
+
+  std::array<std::array<uint8_t, ml_dsa_runtime::SigningSeedByteLen>, REQ_CNT> rnds{};
+  std::array<std::array<uint8_t, 32>, REQ_CNT> msgs{};
+  std::array<std::vector<uint8_t>, REQ_CNT> sigs{}, expected_sigs{};
+  std::vector<ml_dsa_runtime::sign_request_t> sign_reqs;
+
+  for (size_t i = 0; i < REQ_CNT; i++) {
+    // Interleave parameter sets, while consecutive requests of a parameter set share the secret key.
+    const size_t ps = (i * 7) % PARAM_SETS.size();
+    const auto& vtable = ml_dsa_runtime::select(PARAM_SETS[ps]);
+
+    prng.read(rnds[i]);
+    prng.read(msgs[i]);
+
+    sigs[i].resize(vtable.sig_byte_len);
+    expected_sigs[i].resize(vtable.sig_byte_len);
+
+    EXPECT_TRUE(vtable.sign(rnds[i], skeys[ps], msgs[i], expected_sigs[i]));
+    sign_reqs.push_back({ PARAM_SETS[ps], rnds[i], skeys[ps], msgs[i], sigs[i] });
+  }
+
+  // Request with truncated signature buffer must be rejected, without affecting others.
+  std::vector<uint8_t> short_sig(ml_dsa_65::SigByteLen - 1);
+  sign_reqs.push_back({ ml_dsa_runtime::param_set_t::ml_dsa_65, rnds[0], skeys[1], msgs[0], short_sig });
+
+  auto sign_status = std::make_unique<bool[]>(sign_reqs.size());
+  ml_dsa_runtime::sign_batch(sign_reqs, std::span(sign_status.get(), sign_reqs.size()));
+
+  for (size_t i = 0; i < REQ_CNT; i++) {
+    EXPECT_TRUE(sign_status[i]);
+    EXPECT_EQ(sigs[i], expected_sigs[i]);
+  }
+  EXPECT_FALSE(sign_status[REQ_CNT]);
+
+  std::vector<ml_dsa_runtime::verify_request_t> verify_reqs;
+  for (size_t i = 0; i < REQ_CNT; i++) {
+    const size_t ps = (i * 7) % PARAM_SETS.size();
+    verify_reqs.push_back({ PARAM_SETS[ps], pkeys[ps], msgs[i], sigs[i] });
+  }
+
+  // Corrupt one of the signatures.
+  ml_dsa_test_helper::random_bit_flip(std::span(sigs[3]));
+
+  auto verify_status = std::make_unique<bool[]>(verify_reqs.size());
+  ml_dsa_runtime::verify_batch(verify_reqs, std::span(verify_status.get(), verify_reqs.size()));
+
+  for (size_t i = 0; i < REQ_CNT; i++) {
+    EXPECT_EQ(verify_status[i], i != 3);
+  }
+}
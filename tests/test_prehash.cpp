@@ -0,0 +1,92 @@
+#include "ml_dsa/ml_dsa_65.hpp"
+#include "test_helper.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string_view>
+
+// Given a pre-hash function, this routine checks its digest of message "abc", computed in one go and in streaming
+// fashion, one byte at a time, against the expected one.
+template<ml_dsa_prehash::hash_t hash>
+static void
+test_prehash_abc(std::string_view expected_hex)
+{
+  constexpr std::array<uint8_t, 3> msg = { 'a', 'b', 'c' };
+  const auto expected = ml_dsa_test_helper::from_hex<ml_dsa_prehash::DIGEST_BYTE_LEN<hash>>(expected_hex);
+
+  std::array<uint8_t, ml_dsa_prehash::DIGEST_BYTE_LEN<hash>> digest{};
+  ml_dsa_prehash::digest<hash>(msg, digest);
+  EXPECT_EQ(digest, expected);
+
+  ml_dsa_prehash::prehasher_t<hash> prehasher;
+  for (size_t i = 0; i < msg.size(); i++) {
+    prehasher.absorb(std::span(msg).subspan(i, 1));
+  }
+  prehasher.digest(digest);
+  EXPECT_EQ(digest, expected);
+
+  EXPECT_EQ(ml_dsa_prehash::digest_byte_len(hash), digest.size());
+}
+
+// Test that each pre-hash function of HashML-DSA produces the expected digest, be it computed in one go or in streaming
+// fashion, using SHA3 and SHAKE test vectors for message "abc".
+TEST(ML_DSA, PreHashFunctions)
+{
+  test_prehash_abc<ml_dsa_prehash::hash_t::sha3_256>("3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532");
+  test_prehash_abc<ml_dsa_prehash::hash_t::sha3_512>("b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e"
+                                                     "10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0");
+  test_prehash_abc<ml_dsa_prehash::hash_t::shake128>("5881092dd818bf5cf8a3ddb793fbcba74097d5c526a6d35f97b83351940f2cc8");
+  test_prehash_abc<ml_dsa_prehash::hash_t::shake256>("483366601360a8771c6863080cc4114d8db44530f8f1e1ee4f94ea37e78b5739"
+                                                     "d5a15bef186a5386c75744c0527e1faa9f8726e462a12a4feb06bd8801e751e4");
+
+  EXPECT_EQ(ml_dsa_prehash::digest_byte_len(static_cast<ml_dsa_prehash::hash_t>(0xff)), 0u);
+}
+
+// Test that HashML-DSA signature is the ML-DSA-65 signature over formatted message
+// M' = 1 || len(ctx) || ctx || OID || PH(M), where OID is DER encoding of object identifier of the pre-hash function.
+TEST(ML_DSA, HashMLDSAFormattedMessage)
+{
+  constexpr auto hash = ml_dsa_prehash::hash_t::shake256;
+  constexpr std::array<uint8_t, ml_dsa_prehash::OID_BYTE_LEN> oid = { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x0c };
+
+  std::array<uint8_t, ml_dsa_65::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_65::PubKeyByteLen> pkey{};
+  std::array<uint8_t, ml_dsa_65::SecKeyByteLen> skey{};
+  std::array<uint8_t, ml_dsa_65::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_65::SigByteLen> sig{};
+  std::array<uint8_t, ml_dsa_65::SigByteLen> sig_formatted{};
+  std::array<uint8_t, 1024> msg{};
+  std::array<uint8_t, 13> ctx{};
+  std::array<uint8_t, ml_dsa_prehash::DIGEST_BYTE_LEN<hash>> digest{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg);
+  prng.read(ctx);
+
+  ml_dsa_65::keygen(seed, pkey, skey);
+  ml_dsa_prehash::digest<hash>(msg, digest);
+
+  EXPECT_TRUE(ml_dsa_65::sign_prehash(rnd, skey, ctx, hash, digest, sig));
+
+  std::vector<uint8_t> formatted{ 1, static_cast<uint8_t>(ctx.size()) };
+  formatted.insert(formatted.end(), ctx.begin(), ctx.end());
+  formatted.insert(formatted.end(), oid.begin(), oid.end());
+  formatted.insert(formatted.end(), digest.begin(), digest.end());
+
+  ml_dsa_65::sign(rnd, skey, formatted, sig_formatted);
+  EXPECT_EQ(sig, sig_formatted);
+
+  EXPECT_TRUE(ml_dsa_65::verify_prehash(pkey, ctx, hash, digest, sig));
+  EXPECT_TRUE(ml_dsa_65::verify(pkey, formatted, sig));
+
+  // Empty context string, as long as the longest one, are both fine
+  std::array<uint8_t, ml_dsa_65::MaxCtxByteLen> long_ctx{};
+  prng.read(long_ctx);
+
+  EXPECT_TRUE(ml_dsa_65::sign_prehash(rnd, skey, {}, hash, digest, sig));
+  EXPECT_TRUE(ml_dsa_65::verify_prehash(pkey, {}, hash, digest, sig));
+  EXPECT_TRUE(ml_dsa_65::sign_prehash(rnd, skey, long_ctx, hash, digest, sig));
+  EXPECT_TRUE(ml_dsa_65::verify_prehash(pkey, long_ctx, hash, digest, sig));
+  EXPECT_FALSE(ml_dsa_65::verify_prehash(pkey, {}, hash, digest, sig));
+}
@@ -0,0 +1,108 @@
+#include "ml_dsa/ml_dsa_44.hpp"
+#include "ml_dsa/ml_dsa_65.hpp"
+#include "test_helper.hpp"
+#include <cstdlib>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Given bytes, this routine writes them to a temporary file and maps that file back, read-only, returning the mapping.
+static std::span<const uint8_t>
+map_through_file(std::span<const uint8_t> bytes)
+{
+  char path[] = "/tmp/ml_dsa_image_XXXXXX";
+  const int fd = mkstemp(path);
+  EXPECT_GE(fd, 0);
+  unlink(path);
+
+  EXPECT_EQ(write(fd, bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+
+  void* const addr = mmap(nullptr, bytes.size(), PROT_READ, MAP_PRIVATE, fd, 0);
+  EXPECT_NE(addr, MAP_FAILED);
+  close(fd);
+
+  return std::span(static_cast<const uint8_t*>(addr), bytes.size());
+}
+
+// Test that images of prepared ML-DSA-65 keys, written to a file and mapped back, can be used in place for signing and
+// verification, producing the very same signature, while images of other kind, parameter set or version are rejected.
+TEST(ML_DSA, PreparedKeyImagesUsableFromMapping)
+{
+  std::array<uint8_t, ml_dsa_65::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_65::PubKeyByteLen> pkey{};
+  std::array<uint8_t, ml_dsa_65::SecKeyByteLen> skey{};
+  std::array<uint8_t, ml_dsa_65::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_65::SigByteLen> sig{};
+  std::array<uint8_t, ml_dsa_65::SigByteLen> sig_from_image{};
+  std::array<uint8_t, 32> msg{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg);
+
+  ml_dsa_65::keygen(seed, pkey, skey);
+  ml_dsa_65::sign(rnd, skey, msg, sig);
+
+  auto prepared_pkey = std::make_unique<ml_dsa_65::prepared_pubkey_t>();
+  auto prepared_skey = std::make_unique<ml_dsa_65::prepared_seckey_t>();
+
+  ml_dsa_65::prepare_pubkey(pkey, *prepared_pkey);
+  ml_dsa_65::prepare_seckey(skey, *prepared_skey);
+
+  std::vector<uint8_t> pkey_image(ml_dsa_65::PreparedPubKeyImageByteLen);
+  std::vector<uint8_t> skey_image(ml_dsa_65::PreparedSecKeyImageByteLen);
+
+  ml_dsa_65::write_image(*prepared_pkey, std::span<uint8_t, ml_dsa_65::PreparedPubKeyImageByteLen>(pkey_image));
+  ml_dsa_65::write_image(*prepared_skey, std::span<uint8_t, ml_dsa_65::PreparedSecKeyImageByteLen>(skey_image));
+
+  const auto pkey_mapping = map_through_file(pkey_image);
+  const auto skey_mapping = map_through_file(skey_image);
+
+  const auto* pkey_view = ml_dsa_65::view_prepared_pubkey(pkey_mapping);
+  const auto* skey_view = ml_dsa_65::view_prepared_seckey(skey_mapping);
+
+  ASSERT_NE(pkey_view, nullptr);
+  ASSERT_NE(skey_view, nullptr);
+
+  ml_dsa_65::sign(rnd, *skey_view, msg, sig_from_image);
+
+  EXPECT_EQ(sig, sig_from_image);
+  EXPECT_TRUE(ml_dsa_65::verify(*pkey_view, msg, sig));
+
+  // Packed prepared public key
+  auto packed_pkey = std::make_unique<ml_dsa_65::packed_prepared_pubkey_t>();
+  ml_dsa_65::prepare_pubkey(pkey, *packed_pkey);
+
+  std::vector<uint8_t> packed_pkey_image(ml_dsa_65::PackedPreparedPubKeyImageByteLen);
+  ml_dsa_65::write_image(*packed_pkey, std::span<uint8_t, ml_dsa_65::PackedPreparedPubKeyImageByteLen>(packed_pkey_image));
+
+  const auto packed_pkey_mapping = map_through_file(packed_pkey_image);
+  const auto* packed_pkey_view = ml_dsa_65::view_packed_prepared_pubkey(packed_pkey_mapping);
+
+  ASSERT_NE(packed_pkey_view, nullptr);
+  EXPECT_TRUE(ml_dsa_65::verify(*packed_pkey_view, msg, sig));
+  EXPECT_EQ(ml_dsa_65::view_prepared_pubkey(packed_pkey_mapping), nullptr);
+
+  // Wrong kind or parameter set
+  EXPECT_EQ(ml_dsa_65::view_prepared_seckey(pkey_mapping), nullptr);
+  EXPECT_EQ(ml_dsa_65::view_prepared_pubkey(skey_mapping), nullptr);
+  EXPECT_EQ(ml_dsa_44::view_prepared_pubkey(pkey_mapping.first(ml_dsa_44::PreparedPubKeyImageByteLen)), nullptr);
+
+  // Truncated image
+  EXPECT_EQ(ml_dsa_65::view_prepared_pubkey(pkey_mapping.first(pkey_mapping.size() - 64)), nullptr);
+
+  // Unknown version
+  auto pkey_image_copy = pkey_image;
+  pkey_image_copy[offsetof(ml_dsa_image::header_t, version)] ^= 1;
+
+  const auto corrupted_mapping = map_through_file(pkey_image_copy);
+  EXPECT_EQ(ml_dsa_65::view_prepared_pubkey(corrupted_mapping), nullptr);
+
+  munmap(const_cast<uint8_t*>(pkey_mapping.data()), pkey_mapping.size());
+  munmap(const_cast<uint8_t*>(skey_mapping.data()), skey_mapping.size());
+  munmap(const_cast<uint8_t*>(corrupted_mapping.data()), corrupted_mapping.size());
+  munmap(const_cast<uint8_t*>(packed_pkey_mapping.data()), packed_pkey_mapping.size());
+}
@@ -1,5 +1,6 @@
 #include "ml_dsa/internals/math/reduction.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <tuple>
 
 // Given a random element ∈ Z_q, this routine tests whether extracting high and low order bits & then reconstructing
@@ -52,3 +53,89 @@ TEST(ML_DSA, MakingAndUsingOfHintBits)
   test_decompose<((ml_dsa_field::Q - 1u) / 32u) << 1, 997u>();
   test_decompose<((ml_dsa_field::Q - 1u) / 32u) << 1, 1981u>();
 }
+
+// Straight-forward, division based implementation of Decompose, following algorithm 30 of ML-DSA specification
+// https://doi.org/10.6028/NIST.FIPS.204.ipd, returning low order bits as an element ∈ Z_q.
+template<uint32_t alpha>
+static std::pair<ml_dsa_field::zq_t, ml_dsa_field::zq_t>
+decompose_reference(const uint32_t r)
+{
+  const int64_t r_ = static_cast<int64_t>(r);
+  const int64_t alpha_ = static_cast<int64_t>(alpha);
+
+  int64_t r0 = r_ % alpha_;
+  if (r0 > (alpha_ / 2)) {
+    r0 -= alpha_;
+  }
+
+  int64_t r1 = 0;
+  if ((r_ - r0) == static_cast<int64_t>(ml_dsa_field::Q - 1u)) {
+    r0 -= 1;
+  } else {
+    r1 = (r_ - r0) / alpha_;
+  }
+
+  const int64_t r0_ = r0 < 0 ? r0 + ml_dsa_field::Q : r0;
+  return { ml_dsa_field::zq_t(static_cast<uint32_t>(r1)), ml_dsa_field::zq_t(static_cast<uint32_t>(r0_)) };
+}
+
+// Exhaustively test that division-free decomposition matches the straight-forward one, for each element ∈ Z_q.
+template<uint32_t alpha>
+static void
+test_decompose_exhaustive()
+{
+  for (uint32_t r = 0; r < ml_dsa_field::Q; r++) {
+    const auto [r1, r0] = ml_dsa_reduction::decompose<alpha>(ml_dsa_field::zq_t(r));
+    const auto [r1_, r0_] = decompose_reference<alpha>(r);
+
+    ASSERT_EQ(r1, r1_);
+    ASSERT_EQ(r0, r0_);
+  }
+}
+
+TEST(ML_DSA, DecomposeWithoutDivision)
+{
+  test_decompose_exhaustive<((ml_dsa_field::Q - 1u) / 88u) << 1>();
+  test_decompose_exhaustive<((ml_dsa_field::Q - 1u) / 32u) << 1>();
+}
+
+// Given random w, small cs2 and ct0, s.t. rejection check of signing procedure passes, this routine tests that hint
+// bit computed from already decomposed w matches the one computed by MakeHint(-ct0, w - cs2 + ct0).
+template<uint32_t alpha, uint32_t beta, size_t rounds = 1ul << 20>
+static void
+test_make_hint_decomposed()
+{
+  constexpr uint32_t γ2 = alpha >> 1;
+  ml_dsa_prng::prng_t<256> prng;
+
+  const auto small = [&](const uint32_t bound) {
+    const uint32_t v = ml_dsa_field::zq_t::random(prng).raw() % (2 * bound + 1u);
+    return ml_dsa_field::zq_t(bound) - ml_dsa_field::zq_t(v);
+  };
+
+  for (size_t i = 0; i < rounds; i++) {
+    const ml_dsa_field::zq_t w = ml_dsa_field::zq_t::random(prng);
+    const ml_dsa_field::zq_t cs2 = small(beta);
+    const ml_dsa_field::zq_t ct0 = small(γ2 - 1u);
+
+    const auto [w1, w0] = ml_dsa_reduction::decompose<alpha>(w);
+    const ml_dsa_field::zq_t r0 = w0 - cs2;
+
+    const uint32_t r0_norm = std::min(r0.raw(), (-r0).raw());
+    if (r0_norm >= (γ2 - beta)) {
+      continue;
+    }
+
+    const ml_dsa_field::zq_t h = ml_dsa_reduction::make_hint<alpha>(-ct0, w - cs2 + ct0);
+    const ml_dsa_field::zq_t h_ = ml_dsa_reduction::make_hint_decomposed<alpha>(r0 + ct0, w1);
+
+    EXPECT_EQ(h, h_);
+  }
+}
+
+TEST(ML_DSA, MakingHintBitsFromDecomposition)
+{
+  test_make_hint_decomposed<((ml_dsa_field::Q - 1u) / 88u) << 1, 78u>();
+  test_make_hint_decomposed<((ml_dsa_field::Q - 1u) / 32u) << 1, 196u>();
+  test_make_hint_decomposed<((ml_dsa_field::Q - 1u) / 32u) << 1, 120u>();
+}
@@ -0,0 +1,113 @@
+#include "ml_dsa/ml_dsa_shm_cache.hpp"
+#include "test_helper.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Test that a shared memory cache of prepared ML-DSA-65 public keys, attached by another process, verifies signatures
+// same as `ml_dsa_65::verify` does, while a key prepared by one process is found in the cache by the other one.
+TEST(ML_DSA, SharedMemoryPreparedPubKeyCache)
+{
+  using cache_t = ml_dsa_shm_cache::cache_t<ml_dsa_runtime::param_set_t::ml_dsa_65>;
+
+  constexpr size_t KEY_CNT = 3;
+  const std::string name = "/ml_dsa_test_" + std::to_string(getpid());
+
+  std::array<std::array<uint8_t, ml_dsa_65::PubKeyByteLen>, KEY_CNT> pkeys{};
+  std::array<std::array<uint8_t, ml_dsa_65::SigByteLen>, KEY_CNT> sigs{};
+  std::array<uint8_t, 32> msg{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(msg);
+
+  for (size_t i = 0; i < KEY_CNT; i++) {
+    std::array<uint8_t, ml_dsa_65::KeygenSeedByteLen> seed{};
+    std::array<uint8_t, ml_dsa_65::SigningSeedByteLen> rnd{};
+    std::array<uint8_t, ml_dsa_65::SecKeyByteLen> skey{};
+
+    prng.read(seed);
+    prng.read(rnd);
+
+    ml_dsa_65::keygen(seed, pkeys[i], skey);
+    ml_dsa_65::sign(rnd, skey, msg, sigs[i]);
+  }
+
+  auto cache = cache_t::create(name, 64);
+  ASSERT_NE(cache, nullptr);
+
+  // Segment of another parameter set isn't attachable
+  EXPECT_EQ(ml_dsa_shm_cache::cache_t<ml_dsa_runtime::param_set_t::ml_dsa_44>::attach(name), nullptr);
+
+  EXPECT_TRUE(cache->verify(pkeys[0], msg, sigs[0]));
+  EXPECT_FALSE(cache->verify(pkeys[0], msg, sigs[1]));
+
+  // Child process finds the key, prepared by its parent, and caches another one
+  const pid_t pid = fork();
+  if (pid == 0) {
+    auto attached = cache_t::attach(name);
+    const bool ok = (attached != nullptr) && attached->verify(pkeys[0], msg, sigs[0]) && attached->verify(pkeys[1], msg, sigs[1]);
+    _exit(ok ? 0 : 1);
+  }
+
+  int status = 0;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  EXPECT_TRUE(WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+
+  EXPECT_TRUE(cache->verify(pkeys[1], msg, sigs[1]));
+  EXPECT_FALSE(cache->verify(pkeys[2], msg, sigs[1]));
+  EXPECT_TRUE(cache->verify(pkeys[2], msg, sigs[2]));
+
+  // Keys 0 and 1 were each prepared once, by parent and child respectively, key 2 was prepared when first seen.
+  const auto stats = cache->stats();
+  EXPECT_EQ(stats.misses, stats.inserts);
+  EXPECT_EQ(stats.contended, 0u);
+  EXPECT_GE(stats.hits, 4u);
+  EXPECT_EQ(stats.hits + stats.misses, 7u);
+
+  cache_t::unlink(name);
+  EXPECT_EQ(cache_t::attach(name), nullptr);
+}
+
+// Test that a cache with a single bucket keeps verifying correctly, while keys keep evicting each other.
+TEST(ML_DSA, SharedMemoryPreparedPubKeyCacheEviction)
+{
+  using cache_t = ml_dsa_shm_cache::cache_t<ml_dsa_runtime::param_set_t::ml_dsa_44, true>;
+
+  const std::string name = "/ml_dsa_test_eviction_" + std::to_string(getpid());
+
+  std::array<std::array<uint8_t, ml_dsa_44::PubKeyByteLen>, 2> pkeys{};
+  std::array<std::array<uint8_t, ml_dsa_44::SigByteLen>, 2> sigs{};
+  std::array<uint8_t, 32> msg{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(msg);
+
+  for (size_t i = 0; i < pkeys.size(); i++) {
+    std::array<uint8_t, ml_dsa_44::KeygenSeedByteLen> seed{};
+    std::array<uint8_t, ml_dsa_44::SigningSeedByteLen> rnd{};
+    std::array<uint8_t, ml_dsa_44::SecKeyByteLen> skey{};
+
+    prng.read(seed);
+    prng.read(rnd);
+
+    ml_dsa_44::keygen(seed, pkeys[i], skey);
+    ml_dsa_44::sign(rnd, skey, msg, sigs[i]);
+  }
+
+  auto cache = cache_t::create(name, 1);
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->capacity(), 1u);
+
+  for (size_t round = 0; round < 3; round++) {
+    EXPECT_TRUE(cache->verify(pkeys[0], msg, sigs[0]));
+    EXPECT_TRUE(cache->verify(pkeys[1], msg, sigs[1]));
+    EXPECT_FALSE(cache->verify(pkeys[1], msg, sigs[0]));
+  }
+
+  const auto stats = cache->stats();
+  EXPECT_EQ(stats.inserts, 6u);
+  EXPECT_EQ(stats.hits, 3u);
+
+  cache_t::unlink(name);
+}
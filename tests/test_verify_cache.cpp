@@ -0,0 +1,117 @@
+#include "ml_dsa/ml_dsa_verify_cache.hpp"
+#include "test_helper.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+// Test that verification through a cache of successful verifications of ML-DSA-65 signatures produces same result as
+// `ml_dsa_65::verify` does, while only valid signatures are cached and prepared keys share cache entries with raw ones.
+TEST(ML_DSA, VerificationResultCache)
+{
+  constexpr auto ps = ml_dsa_runtime::param_set_t::ml_dsa_65;
+
+  std::array<uint8_t, ml_dsa_65::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_65::PubKeyByteLen> pkey{};
+  std::array<uint8_t, ml_dsa_65::SecKeyByteLen> skey{};
+  std::array<uint8_t, ml_dsa_65::SigningSeedByteLen> rnd{};
+  std::array<uint8_t, ml_dsa_65::SigByteLen> sig{};
+  std::array<uint8_t, 32> msg{};
+
+  ml_dsa_prng::prng_t<192> prng;
+  prng.read(seed);
+  prng.read(rnd);
+  prng.read(msg);
+
+  ml_dsa_65::keygen(seed, pkey, skey);
+  ml_dsa_65::sign(rnd, skey, msg, sig);
+
+  auto bad_sig = sig;
+  ml_dsa_test_helper::random_bit_flip(bad_sig);
+
+  ml_dsa_verify_cache::cache_t cache(1000);
+  EXPECT_EQ(cache.capacity(), 1024u);
+
+  // Invalid signatures always go through full verification
+  EXPECT_FALSE(ml_dsa_verify_cache::verify<ps>(cache, pkey, msg, bad_sig));
+  EXPECT_FALSE(ml_dsa_verify_cache::verify<ps>(cache, pkey, msg, bad_sig));
+  EXPECT_EQ(cache.stats().inserts, 0u);
+
+  EXPECT_TRUE(ml_dsa_verify_cache::verify<ps>(cache, pkey, msg, sig));
+  EXPECT_TRUE(ml_dsa_verify_cache::verify<ps>(cache, pkey, msg, sig));
+
+  // Same signature, verified through a prepared key and μ, is found in the cache
+  auto prepared = std::make_unique<ml_dsa_65::prepared_pubkey_t>();
+  ml_dsa_65::prepare_pubkey(pkey, *prepared);
+
+  std::array<uint8_t, ml_dsa_65::MuByteLen> mu{};
+  ml_dsa::compute_mu(prepared->tr, msg, mu);
+
+  EXPECT_TRUE(ml_dsa_verify_cache::verify_mu<ps>(cache, *prepared, mu, sig));
+  EXPECT_FALSE(ml_dsa_verify_cache::verify_mu<ps>(cache, *prepared, mu, bad_sig));
+
+  // Cached signature doesn't verify another message
+  msg[0] ^= 1;
+  EXPECT_FALSE(ml_dsa_verify_cache::verify<ps>(cache, pkey, msg, sig));
+
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 5u);
+  EXPECT_EQ(stats.inserts, 1u);
+}
+
+// Test that many threads, verifying more valid ML-DSA-44 signatures than the cache can hold, interleaved with invalid
+// ones, through a shared cache, always get the correct result, while signatures keep evicting each other.
+TEST(ML_DSA, VerificationResultCacheConcurrent)
+{
+  constexpr auto ps = ml_dsa_runtime::param_set_t::ml_dsa_44;
+  constexpr size_t SIG_CNT = 16;
+  constexpr size_t THREAD_CNT = 4;
+  constexpr size_t ROUNDS = 4;
+
+  std::array<uint8_t, ml_dsa_44::KeygenSeedByteLen> seed{};
+  std::array<uint8_t, ml_dsa_44::PubKeyByteLen> pkey{};
+  std::array<uint8_t, ml_dsa_44::SecKeyByteLen> skey{};
+  std::vector<std::array<uint8_t, 32>> msgs(SIG_CNT);
+  std::vector<std::array<uint8_t, ml_dsa_44::SigByteLen>> sigs(SIG_CNT);
+
+  ml_dsa_prng::prng_t<128> prng;
+  prng.read(seed);
+  ml_dsa_44::keygen(seed, pkey, skey);
+
+  for (size_t i = 0; i < SIG_CNT; i++) {
+    std::array<uint8_t, ml_dsa_44::SigningSeedByteLen> rnd{};
+    prng.read(rnd);
+    prng.read(msgs[i]);
+
+    ml_dsa_44::sign(rnd, skey, msgs[i], sigs[i]);
+  }
+
+  ml_dsa_verify_cache::cache_t cache(4);
+  ASSERT_EQ(cache.capacity(), 4u);
+
+  std::atomic<size_t> wrong_cnt{ 0 };
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0; t < THREAD_CNT; t++) {
+    threads.emplace_back([&, t]() {
+      for (size_t round = 0; round < ROUNDS; round++) {
+        for (size_t i = 0; i < SIG_CNT; i++) {
+          const size_t j = (i + t) % SIG_CNT;
+
+          wrong_cnt += !ml_dsa_verify_cache::verify<ps>(cache, pkey, msgs[j], sigs[j]);
+          wrong_cnt += ml_dsa_verify_cache::verify<ps>(cache, pkey, msgs[j], sigs[(j + 1) % SIG_CNT]);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(wrong_cnt, 0u);
+
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.hits + stats.misses, 2 * THREAD_CNT * ROUNDS * SIG_CNT);
+  EXPECT_GE(stats.misses, THREAD_CNT * ROUNDS * SIG_CNT);
+  EXPECT_GT(stats.inserts, 0u);
+}
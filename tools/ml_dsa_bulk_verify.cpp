@@ -0,0 +1,374 @@
+#include "ml_dsa/internals/rng/prng.hpp"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Memory-mapped bulk ML-DSA signature verification
+//
+// Verifies manifests, holding millions of ( public key, message digest, signature ) records, of a single parameter set.
+// Manifest is memory-mapped and records are verified in place, without copying or allocating anything per record,
+// sharded across threads in chunks of `CHUNK_RECORDS` records. Results are written to a memory-mapped bitmap, where bit
+// (i mod 8) of byte (i / 8) is set, iff signature of record i is valid. As each chunk covers whole bytes of the bitmap,
+// threads never write to the same byte.
+//
+// Subcommands
+//
+// verify --in MANIFEST --out BITMAP [--threads T]
+//   Verifies all records, writing result bitmap and reporting records per second.
+//
+// generate --param-set 44|65|87 --records N [--keys K] [--digest-len D] [--invalid-every M] --out MANIFEST
+//   Writes a manifest of N records, signed by K distinct keys, where every M-th signature is corrupted, for testing.
+//
+// Manifest format ( little-endian )
+//
+// manifest_header_t || record[0] || record[1] || ... || record[N-1]
+// record = public key || message digest ( D -bytes ) || signature
+//
+// Compile it with
+//
+// make tools -j  # Produces build/tools/ml_dsa_bulk_verify.out
+namespace ml_dsa_bulk_verify {
+
+static constexpr std::array<char, 8> MAGIC = { 'M', 'L', 'D', 'S', 'A', 'M', 'F', 'T' };
+static constexpr uint32_t VERSION = 1;
+
+// Number of records, taken up by a thread at once. Multiple of 8, so that chunks don't share bytes of the bitmap.
+static constexpr size_t CHUNK_RECORDS = 1024;
+static_assert(CHUNK_RECORDS % 8 == 0);
+
+struct manifest_header_t
+{
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t param_set;  // 44, 65 or 87
+  uint32_t digest_len; // Byte length of message digest, in each record
+  uint32_t reserved;
+  uint64_t record_cnt;
+};
+
+static_assert(sizeof(manifest_header_t) == 32);
+
+static std::optional<ml_dsa_runtime::param_set_t>
+parse_param_set(const uint32_t id)
+{
+  switch (id) {
+    case 44:
+      return ml_dsa_runtime::param_set_t::ml_dsa_44;
+    case 65:
+      return ml_dsa_runtime::param_set_t::ml_dsa_65;
+    case 87:
+      return ml_dsa_runtime::param_set_t::ml_dsa_87;
+    default:
+      return std::nullopt;
+  }
+}
+
+// Read-only or read-write memory mapping of a whole file.
+struct mapping_t
+{
+  uint8_t* ptr = nullptr;
+  size_t len = 0;
+
+  mapping_t() = default;
+  mapping_t(const mapping_t&) = delete;
+  mapping_t& operator=(const mapping_t&) = delete;
+
+  ~mapping_t()
+  {
+    if (ptr != nullptr) {
+      munmap(ptr, len);
+    }
+  }
+
+  // Maps existing file for reading.
+  bool open_read(const std::string& path)
+  {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+
+    struct stat st{};
+    const bool ok = (fstat(fd, &st) == 0) && (st.st_size > 0) && map(fd, static_cast<size_t>(st.st_size), PROT_READ);
+    close(fd);
+
+    return ok;
+  }
+
+  // Creates ( or truncates ) file of `n` -bytes and maps it for writing.
+  bool open_write(const std::string& path, const size_t n)
+  {
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      return false;
+    }
+
+    const bool ok = (ftruncate(fd, static_cast<off_t>(n)) == 0) && ((n == 0) || map(fd, n, PROT_READ | PROT_WRITE));
+    close(fd);
+
+    return ok;
+  }
+
+private:
+  bool map(const int fd, const size_t n, const int prot)
+  {
+    void* const addr = mmap(nullptr, n, prot, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+      return false;
+    }
+
+    ptr = static_cast<uint8_t*>(addr);
+    len = n;
+    return true;
+  }
+};
+
+// Verifies records [from, to), of parameter set `param_set`, in place, setting respective bits of the bitmap. `from`
+// must be a multiple of 8. Returns number of valid signatures.
+template<ml_dsa_runtime::param_set_t param_set>
+static size_t
+verify_range(const uint8_t* const records, const size_t digest_len, const size_t from, const size_t to, uint8_t* const bitmap)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+
+  constexpr size_t pubkey_len = ml_dsa_utils::pub_key_len(p::k, p::d);
+  constexpr size_t sig_len = ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ);
+
+  const size_t record_len = pubkey_len + digest_len + sig_len;
+  size_t valid_cnt = 0;
+
+  ml_dsa_dispatch::run([&]() {
+    for (size_t i = from; i < to; i += 8) {
+      uint8_t bits = 0;
+
+      for (size_t j = i; j < std::min(i + 8, to); j++) {
+        const uint8_t* const record = records + j * record_len;
+
+        const auto pubkey = std::span<const uint8_t, pubkey_len>(record, pubkey_len);
+        const auto digest = std::span<const uint8_t>(record + pubkey_len, digest_len);
+        const auto sig = std::span<const uint8_t, sig_len>(record + pubkey_len + digest_len, sig_len);
+
+        const bool is_valid = ml_dsa::verify<p::k, p::l, p::d, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(pubkey, digest, sig);
+
+        bits |= static_cast<uint8_t>(is_valid) << (j - i);
+        valid_cnt += is_valid;
+      }
+
+      bitmap[i / 8] = bits;
+    }
+  });
+
+  return valid_cnt;
+}
+
+static size_t
+verify_range(const ml_dsa_runtime::param_set_t param_set, const uint8_t* const records, const size_t digest_len, const size_t from, const size_t to, uint8_t* const bitmap)
+{
+  switch (param_set) {
+    case ml_dsa_runtime::param_set_t::ml_dsa_44:
+      return verify_range<ml_dsa_runtime::param_set_t::ml_dsa_44>(records, digest_len, from, to, bitmap);
+    case ml_dsa_runtime::param_set_t::ml_dsa_65:
+      return verify_range<ml_dsa_runtime::param_set_t::ml_dsa_65>(records, digest_len, from, to, bitmap);
+    case ml_dsa_runtime::param_set_t::ml_dsa_87:
+      return verify_range<ml_dsa_runtime::param_set_t::ml_dsa_87>(records, digest_len, from, to, bitmap);
+  }
+  return 0;
+}
+
+// Returns value following `--name` in argument list, if present.
+static std::optional<std::string>
+option(const std::vector<std::string_view>& args, const std::string_view name)
+{
+  for (size_t i = 0; i + 1 < args.size(); i++) {
+    if (args[i] == name) {
+      return std::string(args[i + 1]);
+    }
+  }
+  return std::nullopt;
+}
+
+static int
+verify_main(const std::vector<std::string_view>& args)
+{
+  const auto in_path = option(args, "--in");
+  const auto out_path = option(args, "--out");
+
+  if (!in_path || !out_path) {
+    std::fprintf(stderr, "usage: verify --in MANIFEST --out BITMAP [--threads T]\n");
+    return 1;
+  }
+
+  size_t threads = std::max(1u, std::thread::hardware_concurrency());
+  if (const auto v = option(args, "--threads")) {
+    threads = std::max<size_t>(1, std::stoul(*v));
+  }
+
+  mapping_t manifest;
+  if (!manifest.open_read(*in_path) || (manifest.len < sizeof(manifest_header_t))) {
+    std::fprintf(stderr, "failed to map manifest %s: %s\n", in_path->c_str(), std::strerror(errno));
+    return 1;
+  }
+
+  manifest_header_t hdr{};
+  std::memcpy(&hdr, manifest.ptr, sizeof(hdr));
+
+  const auto param_set = parse_param_set(hdr.param_set);
+  if ((hdr.magic != MAGIC) || (hdr.version != VERSION) || !param_set) {
+    std::fprintf(stderr, "%s is not a ML-DSA manifest, of version %u\n", in_path->c_str(), VERSION);
+    return 1;
+  }
+
+  const auto& vtable = ml_dsa_runtime::select(*param_set);
+  const size_t record_len = vtable.pubkey_byte_len + hdr.digest_len + vtable.sig_byte_len;
+  const size_t record_cnt = hdr.record_cnt;
+
+  if ((manifest.len - sizeof(manifest_header_t)) / record_len < record_cnt) {
+    std::fprintf(stderr, "%s is truncated, expected %zu records\n", in_path->c_str(), record_cnt);
+    return 1;
+  }
+
+  // Records are visited in increasing order, by each thread.
+  madvise(manifest.ptr, manifest.len, MADV_SEQUENTIAL);
+
+  mapping_t bitmap;
+  if (!bitmap.open_write(*out_path, (record_cnt + 7) / 8)) {
+    std::fprintf(stderr, "failed to map bitmap %s: %s\n", out_path->c_str(), std::strerror(errno));
+    return 1;
+  }
+
+  const uint8_t* const records = manifest.ptr + sizeof(manifest_header_t);
+  const size_t chunk_cnt = (record_cnt + CHUNK_RECORDS - 1) / CHUNK_RECORDS;
+
+  std::atomic<size_t> next_chunk{ 0 };
+  std::atomic<size_t> valid_cnt{ 0 };
+  std::vector<std::thread> workers;
+
+  const auto t0 = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < std::min(threads, std::max<size_t>(chunk_cnt, 1)); i++) {
+    workers.emplace_back([&]() {
+      size_t valid = 0;
+
+      for (size_t chunk = next_chunk.fetch_add(1); chunk < chunk_cnt; chunk = next_chunk.fetch_add(1)) {
+        const size_t from = chunk * CHUNK_RECORDS;
+        const size_t to = std::min(from + CHUNK_RECORDS, record_cnt);
+
+        valid += verify_range(*param_set, records, hdr.digest_len, from, to, bitmap.ptr);
+      }
+
+      valid_cnt.fetch_add(valid);
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  std::printf("records     : %zu ( %zu valid, %zu invalid )\n", record_cnt, valid_cnt.load(), record_cnt - valid_cnt.load());
+  std::printf("threads     : %zu\n", workers.size());
+  std::printf("throughput  : %.1f records/s\n", static_cast<double>(record_cnt) / elapsed);
+
+  return 0;
+}
+
+static int
+generate_main(const std::vector<std::string_view>& args)
+{
+  const auto ps_name = option(args, "--param-set");
+  const auto record_cnt = option(args, "--records");
+  const auto out_path = option(args, "--out");
+  const auto param_set = ps_name ? parse_param_set(static_cast<uint32_t>(std::stoul(*ps_name))) : std::nullopt;
+
+  if (!param_set || !record_cnt || !out_path) {
+    std::fprintf(stderr, "usage: generate --param-set 44|65|87 --records N [--keys K] [--digest-len D] [--invalid-every M] --out MANIFEST\n");
+    return 1;
+  }
+
+  const size_t n = std::stoul(*record_cnt);
+  const size_t key_cnt = std::max<size_t>(1, std::stoul(option(args, "--keys").value_or("16")));
+  const size_t digest_len = std::stoul(option(args, "--digest-len").value_or("32"));
+  const size_t invalid_every = std::stoul(option(args, "--invalid-every").value_or("0"));
+
+  const auto& vtable = ml_dsa_runtime::select(*param_set);
+  const size_t record_len = vtable.pubkey_byte_len + digest_len + vtable.sig_byte_len;
+
+  mapping_t manifest;
+  if (!manifest.open_write(*out_path, sizeof(manifest_header_t) + n * record_len)) {
+    std::fprintf(stderr, "failed to map manifest %s: %s\n", out_path->c_str(), std::strerror(errno));
+    return 1;
+  }
+
+  const manifest_header_t hdr{ MAGIC, VERSION, static_cast<uint32_t>(std::stoul(*ps_name)), static_cast<uint32_t>(digest_len), 0, n };
+  std::memcpy(manifest.ptr, &hdr, sizeof(hdr));
+
+  ml_dsa_prng::prng_t<256> prng;
+
+  std::vector<std::vector<uint8_t>> pubkeys(key_cnt, std::vector<uint8_t>(vtable.pubkey_byte_len));
+  std::vector<std::vector<uint8_t>> seckeys(key_cnt, std::vector<uint8_t>(vtable.seckey_byte_len));
+
+  for (size_t i = 0; i < key_cnt; i++) {
+    std::array<uint8_t, ml_dsa_runtime::KeygenSeedByteLen> seed{};
+    prng.read(seed);
+    vtable.keygen(seed, pubkeys[i], seckeys[i]);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    uint8_t* const record = manifest.ptr + sizeof(manifest_header_t) + i * record_len;
+
+    const auto pubkey = std::span<uint8_t>(record, vtable.pubkey_byte_len);
+    const auto digest = std::span<uint8_t>(record + vtable.pubkey_byte_len, digest_len);
+    const auto sig = std::span<uint8_t>(record + vtable.pubkey_byte_len + digest_len, vtable.sig_byte_len);
+
+    std::array<uint8_t, ml_dsa_runtime::SigningSeedByteLen> rnd{};
+    prng.read(rnd);
+    prng.read(digest);
+
+    const size_t key = i % key_cnt;
+    std::copy(pubkeys[key].begin(), pubkeys[key].end(), pubkey.begin());
+    vtable.sign(rnd, seckeys[key], digest, sig);
+
+    if ((invalid_every != 0) && (i % invalid_every == invalid_every - 1)) {
+      sig[i % sig.size()] ^= 1;
+    }
+  }
+
+  return 0;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+  const std::vector<std::string_view> args(argv + std::min(argc, 2), argv + argc);
+  const std::string_view cmd = (argc > 1) ? argv[1] : "";
+
+  try {
+    if (cmd == "verify") {
+      return ml_dsa_bulk_verify::verify_main(args);
+    }
+    if (cmd == "generate") {
+      return ml_dsa_bulk_verify::generate_main(args);
+    }
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "error: %s\n", e.what());
+    return 1;
+  }
+
+  std::fprintf(stderr, "usage: %s verify|generate [options], see tools/ml_dsa_bulk_verify.cpp\n", argv[0]);
+  return 1;
+}
@@ -0,0 +1,971 @@
+#include "ml_dsa/internals/rng/prng.hpp"
+#include "ml_dsa/ml_dsa_44.hpp"
+#include "ml_dsa/ml_dsa_65.hpp"
+#include "ml_dsa/ml_dsa_87.hpp"
+#include "ml_dsa/ml_dsa_runtime.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// Local ML-DSA signing daemon
+//
+// A sidecar signer, which keeps ML-DSA secret keys, in their prepared form, resident in its own address space, so that
+// application processes on the same host never hold secret keys. Applications send signing requests, naming a key by
+// its numeric identifier and carrying either the message or its 64 -bytes message representative μ = H(tr || M, 64),
+// over a Unix domain socket. Requests arriving concurrently, on any number of connections, are coalesced, for a few
+// microseconds, into batches, each of which is signed by one of the worker threads, in one go.
+//
+// Subcommands
+//
+// keygen --param-set 44|65|87 --out PREFIX
+//   Generates a fresh keypair, writing raw public and secret key to PREFIX.pub and PREFIX.sec.
+//
+// serve --socket PATH --key ID:44|65|87:SECKEY_FILE [--key ...] [--threads T] [--batch-window-us W] [--max-batch B]
+//   Serves signing requests, until SIGINT/ SIGTERM. Socket file is only accessible by the owner.
+//
+// load --socket PATH --key ID [--connections C] [--requests N] [--pipeline P] [--msg-len M] [--mu]
+//      [--param-set 44|65|87 --pubkey PUBKEY_FILE]
+//   Built-in load generator. Opens C connections, each keeping P requests in flight, until N requests are signed in
+//   total, reporting throughput and latency percentiles. With `--mu`, μ is computed on the client side. When public key
+//   is given, each signature is verified too, which costs client side CPU time.
+//
+// Wire format ( native byte order, as both ends are on the same host )
+//
+// Request  : request_header_t || payload ( message, μ or nothing )
+// Response : response_header_t || payload ( signature or tr )
+//
+// Compile it with
+//
+// make tools -j  # Produces build/tools/ml_dsa_signer.out
+namespace ml_dsa_signer {
+
+// Kind of a request, sent to the daemon.
+enum class request_kind_t : uint8_t
+{
+  sign_msg = 0, // Sign message, carried as payload
+  sign_mu = 1,  // Sign 64 -bytes message representative μ, carried as payload
+  get_tr = 2,   // Fetch 64 -bytes public key hash tr of the key, required for computing μ
+};
+
+// Status of a response, received from the daemon.
+enum class status_t : int32_t
+{
+  ok = 0,
+  unknown_key = -1,
+  bad_request = -2,
+  bad_length = -3,
+};
+
+struct request_header_t
+{
+  uint32_t id;     // Chosen by the client, echoed back in response
+  uint32_t key_id; // Identifier of the key, as passed to `serve --key`
+  uint8_t kind;    // See `request_kind_t`
+  uint8_t reserved[3];
+  uint32_t len; // Byte length of payload
+};
+
+struct response_header_t
+{
+  uint32_t id;
+  int32_t status; // See `status_t`
+  uint32_t len;   // Byte length of payload
+};
+
+// Messages longer than this are rejected, bounding memory a client can make the daemon hold.
+static constexpr size_t MAX_MSG_BYTE_LEN = 1ul << 20;
+
+using steady_clock = std::chrono::steady_clock;
+
+// Reads exactly `n` -bytes from socket, returning false if peer closed connection or an error occurred.
+static bool
+read_exact(const int fd, void* const buf, const size_t n)
+{
+  auto ptr = static_cast<uint8_t*>(buf);
+  size_t off = 0;
+
+  while (off < n) {
+    const ssize_t ret = recv(fd, ptr + off, n - off, 0);
+    if (ret == 0) {
+      return false;
+    }
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+
+    off += static_cast<size_t>(ret);
+  }
+
+  return true;
+}
+
+// Writes all `n` -bytes to socket, returning false if an error occurred.
+static bool
+write_all(const int fd, const void* const buf, const size_t n)
+{
+  auto ptr = static_cast<const uint8_t*>(buf);
+  size_t off = 0;
+
+  while (off < n) {
+    const ssize_t ret = send(fd, ptr + off, n - off, MSG_NOSIGNAL);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+
+    off += static_cast<size_t>(ret);
+  }
+
+  return true;
+}
+
+// Returns parameter set, named by "44", "65" or "87".
+static std::optional<ml_dsa_runtime::param_set_t>
+parse_param_set(const std::string_view name)
+{
+  if (name == "44") {
+    return ml_dsa_runtime::param_set_t::ml_dsa_44;
+  }
+  if (name == "65") {
+    return ml_dsa_runtime::param_set_t::ml_dsa_65;
+  }
+  if (name == "87") {
+    return ml_dsa_runtime::param_set_t::ml_dsa_87;
+  }
+  return std::nullopt;
+}
+
+static std::optional<std::vector<uint8_t>>
+read_file(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static bool
+write_file(const std::string& path, std::span<const uint8_t> bytes, const mode_t mode)
+{
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+
+  file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  file.close();
+
+  return file.good() && (chmod(path.c_str(), mode) == 0);
+}
+
+// Overwrites n -bytes, starting at `ptr`, with zeros, in a way compiler can't optimize away.
+static void
+wipe(void* const ptr, const size_t n)
+{
+  auto bytes = static_cast<volatile uint8_t*>(ptr);
+  for (size_t i = 0; i < n; i++) {
+    bytes[i] = 0;
+  }
+}
+
+// Secret key, kept resident in its prepared form, along with public key hash tr.
+struct signing_key_t
+{
+  ml_dsa_runtime::param_set_t param_set;
+  std::variant<std::unique_ptr<ml_dsa_44::prepared_seckey_t>, std::unique_ptr<ml_dsa_65::prepared_seckey_t>, std::unique_ptr<ml_dsa_87::prepared_seckey_t>> prepared;
+
+  const std::array<uint8_t, 64>& tr() const
+  {
+    return std::visit([](const auto& p) -> const std::array<uint8_t, 64>& { return p->tr; }, prepared);
+  }
+
+  size_t sig_byte_len() const { return ml_dsa_runtime::select(param_set).sig_byte_len; }
+
+  ~signing_key_t()
+  {
+    std::visit(
+      [](auto& p) {
+        if (p) {
+          wipe(p.get(), sizeof(*p));
+        }
+      },
+      prepared);
+  }
+};
+
+// Given secret key bytes of a parameter set, this routine returns the prepared key, if byte length matches.
+template<ml_dsa_runtime::param_set_t param_set, typename prepared_seckey_t>
+static std::unique_ptr<signing_key_t>
+prepare_key(std::span<const uint8_t> seckey)
+{
+  using p = ml_dsa_runtime::params_t<param_set>;
+  constexpr size_t seckey_len = ml_dsa_utils::sec_key_len(p::k, p::l, p::η, p::d);
+
+  if (seckey.size() != seckey_len) {
+    return nullptr;
+  }
+
+  auto prepared = std::make_unique<prepared_seckey_t>();
+  ml_dsa_dispatch::run([&]() { ml_dsa::prepare_seckey<p::k, p::l, p::d, p::η>(seckey.template first<seckey_len>(), *prepared); });
+
+  auto key = std::make_unique<signing_key_t>();
+  key->param_set = param_set;
+  key->prepared = std::move(prepared);
+
+  return key;
+}
+
+static std::unique_ptr<signing_key_t>
+prepare_key(const ml_dsa_runtime::param_set_t param_set, std::span<const uint8_t> seckey)
+{
+  switch (param_set) {
+    case ml_dsa_runtime::param_set_t::ml_dsa_44:
+      return prepare_key<ml_dsa_runtime::param_set_t::ml_dsa_44, ml_dsa_44::prepared_seckey_t>(seckey);
+    case ml_dsa_runtime::param_set_t::ml_dsa_65:
+      return prepare_key<ml_dsa_runtime::param_set_t::ml_dsa_65, ml_dsa_65::prepared_seckey_t>(seckey);
+    case ml_dsa_runtime::param_set_t::ml_dsa_87:
+      return prepare_key<ml_dsa_runtime::param_set_t::ml_dsa_87, ml_dsa_87::prepared_seckey_t>(seckey);
+  }
+  return nullptr;
+}
+
+// A client connection. Responses may be written by any worker thread, hence writes are serialized.
+struct connection_t
+{
+  int fd;
+  std::mutex write_mtx;
+
+  explicit connection_t(const int fd) : fd(fd) {}
+  ~connection_t() { close(fd); }
+
+  void respond(const uint32_t id, const status_t status, std::span<const uint8_t> payload)
+  {
+    const response_header_t hdr{ id, static_cast<int32_t>(status), static_cast<uint32_t>(payload.size()) };
+
+    std::lock_guard lock(write_mtx);
+    if (write_all(fd, &hdr, sizeof(hdr))) {
+      write_all(fd, payload.data(), payload.size());
+    }
+  }
+};
+
+// A signing request, waiting to be batched.
+struct pending_t
+{
+  std::shared_ptr<connection_t> conn;
+  request_header_t hdr;
+  std::vector<uint8_t> payload;
+  steady_clock::time_point arrival;
+};
+
+struct config_t
+{
+  std::string socket_path;
+  size_t threads = std::max(1u, std::thread::hardware_concurrency());
+  std::chrono::microseconds batch_window{ 50 };
+  size_t max_batch = 32;
+};
+
+// Signing requests, collected from all connections, and taken out in batches by worker threads.
+class batch_queue_t
+{
+public:
+  explicit batch_queue_t(const config_t& config) : config(config) {}
+
+  void push(pending_t req)
+  {
+    {
+      std::lock_guard lock(mtx);
+      queue.push_back(std::move(req));
+    }
+    cv.notify_one();
+  }
+
+  // Blocks until at least one request is queued, then waits till either `max_batch` requests are queued or the
+  // oldest one has waited for `batch_window`, taking out up to `max_batch` requests. Returns empty batch on shutdown.
+  std::vector<pending_t> pop_batch()
+  {
+    std::unique_lock lock(mtx);
+    cv.wait(lock, [&]() { return stopping || !queue.empty(); });
+
+    if (stopping) {
+      return {};
+    }
+
+    const auto deadline = queue.front().arrival + config.batch_window;
+    cv.wait_until(lock, deadline, [&]() { return stopping || queue.size() >= config.max_batch; });
+
+    const size_t n = std::min(queue.size(), config.max_batch);
+
+    std::vector<pending_t> batch;
+    batch.reserve(n);
+
+    for (size_t i = 0; i < n; i++) {
+      batch.push_back(std::move(queue.front()));
+      queue.pop_front();
+    }
+
+    // Others may have queued up more, than fit into this batch.
+    if (!queue.empty()) {
+      cv.notify_one();
+    }
+
+    return batch;
+  }
+
+  void stop()
+  {
+    {
+      std::lock_guard lock(mtx);
+      stopping = true;
+    }
+    cv.notify_all();
+  }
+
+private:
+  const config_t& config;
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<pending_t> queue;
+  bool stopping = false;
+};
+
+class daemon_t
+{
+public:
+  daemon_t(config_t config, std::unordered_map<uint32_t, std::unique_ptr<signing_key_t>> keys)
+    : config(std::move(config))
+    , keys(std::move(keys))
+    , queue(this->config)
+  {
+  }
+
+  // Runs workers and accepts connections on listening socket, until `stop_requested` is set.
+  void run(const int listen_fd, const std::atomic<bool>& stop_requested)
+  {
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < config.threads; i++) {
+      workers.emplace_back([this]() { work(); });
+    }
+
+    while (!stop_requested.load()) {
+      const int fd = accept(listen_fd, nullptr, nullptr);
+      if (fd < 0) {
+        continue;
+      }
+
+      auto conn = std::make_shared<connection_t>(fd);
+      std::thread([this, conn]() { serve_connection(conn); }).detach();
+    }
+
+    queue.stop();
+    for (auto& worker : workers) {
+      worker.join();
+    }
+
+    const uint64_t n = signed_cnt.load();
+    const uint64_t b = batch_cnt.load();
+    std::fprintf(stderr, "signed %lu requests, in %lu batches, mean batch size %.2f\n", n, b, (b == 0) ? 0. : static_cast<double>(n) / static_cast<double>(b));
+  }
+
+private:
+  // Reads requests off a connection, answering tr requests and malformed ones right away, while queueing signing
+  // requests for batching.
+  void serve_connection(const std::shared_ptr<connection_t>& conn)
+  {
+    while (true) {
+      request_header_t hdr{};
+      if (!read_exact(conn->fd, &hdr, sizeof(hdr))) {
+        return;
+      }
+
+      const auto kind = static_cast<request_kind_t>(hdr.kind);
+      const bool is_sign = (kind == request_kind_t::sign_msg) || (kind == request_kind_t::sign_mu);
+
+      if (hdr.len > MAX_MSG_BYTE_LEN) {
+        conn->respond(hdr.id, status_t::bad_length, {});
+        return;
+      }
+
+      std::vector<uint8_t> payload(hdr.len);
+      if (!read_exact(conn->fd, payload.data(), payload.size())) {
+        return;
+      }
+
+      const auto it = keys.find(hdr.key_id);
+      if (it == keys.end()) {
+        conn->respond(hdr.id, status_t::unknown_key, {});
+        continue;
+      }
+
+      if (kind == request_kind_t::get_tr) {
+        conn->respond(hdr.id, status_t::ok, it->second->tr());
+        continue;
+      }
+
+      if (!is_sign) {
+        conn->respond(hdr.id, status_t::bad_request, {});
+        continue;
+      }
+
+      if ((kind == request_kind_t::sign_mu) && (payload.size() != ml_dsa::MU_BYTE_LEN)) {
+        conn->respond(hdr.id, status_t::bad_length, {});
+        continue;
+      }
+
+      queue.push(pending_t{ conn, hdr, std::move(payload), steady_clock::now() });
+    }
+  }
+
+  // Signs one request, using prepared key of parameter set `param_set`.
+  template<ml_dsa_runtime::param_set_t param_set, typename prepared_seckey_t>
+  static void sign_one(const prepared_seckey_t& prepared, std::span<const uint8_t, ml_dsa::RND_BYTE_LEN> rnd, const pending_t& req, std::span<uint8_t> sig)
+  {
+    using p = ml_dsa_runtime::params_t<param_set>;
+    constexpr size_t sig_len = ml_dsa_utils::sig_len(p::k, p::l, p::γ1, p::ω, p::λ);
+
+    const auto _sig = sig.template first<sig_len>();
+
+    if (static_cast<request_kind_t>(req.hdr.kind) == request_kind_t::sign_mu) {
+      const auto mu = std::span<const uint8_t, ml_dsa::MU_BYTE_LEN>(req.payload.data(), ml_dsa::MU_BYTE_LEN);
+      ml_dsa::sign_mu<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, prepared, mu, _sig);
+    } else {
+      ml_dsa::sign<p::k, p::l, p::d, p::η, p::γ1, p::γ2, p::τ, p::β, p::ω, p::λ>(rnd, prepared, req.payload, _sig);
+    }
+  }
+
+  // Worker thread: takes out a batch at a time, signs all of its requests, within a single dispatch to the active
+  // backend, ordered by key, so that requests for the same prepared key are signed back to back, and responds.
+  void work()
+  {
+    ml_dsa_prng::prng_t<256> prng;
+    std::array<uint8_t, ml_dsa::RND_BYTE_LEN> rnd{};
+
+    while (true) {
+      auto batch = queue.pop_batch();
+      if (batch.empty()) {
+        return;
+      }
+
+      std::stable_sort(batch.begin(), batch.end(), [](const pending_t& a, const pending_t& b) { return a.hdr.key_id < b.hdr.key_id; });
+
+      std::vector<std::vector<uint8_t>> sigs(batch.size());
+
+      ml_dsa_dispatch::run([&]() {
+        for (size_t i = 0; i < batch.size(); i++) {
+          const signing_key_t& key = *keys.at(batch[i].hdr.key_id);
+
+          sigs[i].resize(key.sig_byte_len());
+          prng.read(rnd);
+
+          std::visit(
+            [&](const auto& prepared) {
+              using prepared_t = std::remove_cvref_t<decltype(*prepared)>;
+
+              if constexpr (std::is_same_v<prepared_t, ml_dsa_44::prepared_seckey_t>) {
+                sign_one<ml_dsa_runtime::param_set_t::ml_dsa_44>(*prepared, rnd, batch[i], sigs[i]);
+              } else if constexpr (std::is_same_v<prepared_t, ml_dsa_65::prepared_seckey_t>) {
+                sign_one<ml_dsa_runtime::param_set_t::ml_dsa_65>(*prepared, rnd, batch[i], sigs[i]);
+              } else {
+                sign_one<ml_dsa_runtime::param_set_t::ml_dsa_87>(*prepared, rnd, batch[i], sigs[i]);
+              }
+            },
+            key.prepared);
+        }
+      });
+
+      for (size_t i = 0; i < batch.size(); i++) {
+        batch[i].conn->respond(batch[i].hdr.id, status_t::ok, sigs[i]);
+      }
+
+      signed_cnt.fetch_add(batch.size(), std::memory_order_relaxed);
+      batch_cnt.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  config_t config;
+  std::unordered_map<uint32_t, std::unique_ptr<signing_key_t>> keys;
+  batch_queue_t queue;
+
+  std::atomic<uint64_t> signed_cnt{ 0 };
+  std::atomic<uint64_t> batch_cnt{ 0 };
+};
+
+// Returns a connected Unix domain stream socket, or -1.
+static int
+connect_to(const std::string& path)
+{
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+  if (connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+// Returns a listening Unix domain stream socket, bound to `path`, which is only accessible by the owner, or -1.
+static int
+listen_on(const std::string& path)
+{
+  if (path.size() >= sizeof(sockaddr_un::sun_path)) {
+    return -1;
+  }
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+  unlink(path.c_str());
+
+  const mode_t old_mask = umask(0177);
+  const bool bound = bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0;
+  umask(old_mask);
+
+  if (!bound || (listen(fd, SOMAXCONN) != 0)) {
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+static std::atomic<bool> stop_requested{ false };
+
+static void
+on_signal(int)
+{
+  stop_requested.store(true);
+}
+
+// Returns value following `--name` in argument list, if present.
+static std::optional<std::string>
+option(const std::vector<std::string_view>& args, const std::string_view name)
+{
+  for (size_t i = 0; i + 1 < args.size(); i++) {
+    if (args[i] == name) {
+      return std::string(args[i + 1]);
+    }
+  }
+  return std::nullopt;
+}
+
+static bool
+flag(const std::vector<std::string_view>& args, const std::string_view name)
+{
+  return std::find(args.begin(), args.end(), name) != args.end();
+}
+
+static int
+keygen_main(const std::vector<std::string_view>& args)
+{
+  const auto ps_name = option(args, "--param-set");
+  const auto prefix = option(args, "--out");
+  const auto param_set = ps_name ? parse_param_set(*ps_name) : std::nullopt;
+
+  if (!param_set || !prefix) {
+    std::fprintf(stderr, "usage: keygen --param-set 44|65|87 --out PREFIX\n");
+    return 1;
+  }
+
+  const auto& vtable = ml_dsa_runtime::select(*param_set);
+
+  std::array<uint8_t, ml_dsa_runtime::KeygenSeedByteLen> seed{};
+  std::vector<uint8_t> pubkey(vtable.pubkey_byte_len);
+  std::vector<uint8_t> seckey(vtable.seckey_byte_len);
+
+  ml_dsa_prng::prng_t<256> prng;
+  prng.read(seed);
+
+  vtable.keygen(seed, pubkey, seckey);
+
+  const bool ok = write_file(*prefix + ".pub", pubkey, 0644) && write_file(*prefix + ".sec", seckey, 0600);
+
+  wipe(seed.data(), seed.size());
+  wipe(seckey.data(), seckey.size());
+
+  if (!ok) {
+    std::fprintf(stderr, "failed to write keys to %s.{pub,sec}\n", prefix->c_str());
+    return 1;
+  }
+
+  return 0;
+}
+
+static int
+serve_main(const std::vector<std::string_view>& args)
+{
+  config_t config;
+  std::unordered_map<uint32_t, std::unique_ptr<signing_key_t>> keys;
+
+  const auto socket_path = option(args, "--socket");
+  if (!socket_path) {
+    std::fprintf(stderr, "usage: serve --socket PATH --key ID:44|65|87:SECKEY_FILE [--key ...] [--threads T] [--batch-window-us W] [--max-batch B]\n");
+    return 1;
+  }
+  config.socket_path = *socket_path;
+
+  if (const auto v = option(args, "--threads")) {
+    config.threads = std::max<size_t>(1, std::stoul(*v));
+  }
+  if (const auto v = option(args, "--batch-window-us")) {
+    config.batch_window = std::chrono::microseconds(std::stoul(*v));
+  }
+  if (const auto v = option(args, "--max-batch")) {
+    config.max_batch = std::max<size_t>(1, std::stoul(*v));
+  }
+
+  for (size_t i = 0; i + 1 < args.size(); i++) {
+    if (args[i] != "--key") {
+      continue;
+    }
+
+    // ID:PARAM_SET:PATH
+    const std::string spec(args[i + 1]);
+    const size_t c0 = spec.find(':');
+    const size_t c1 = (c0 == std::string::npos) ? std::string::npos : spec.find(':', c0 + 1);
+
+    if (c1 == std::string::npos) {
+      std::fprintf(stderr, "malformed key spec '%s'\n", spec.c_str());
+      return 1;
+    }
+
+    const uint32_t key_id = static_cast<uint32_t>(std::stoul(spec.substr(0, c0)));
+    const auto param_set = parse_param_set(spec.substr(c0 + 1, c1 - c0 - 1));
+    auto seckey = read_file(spec.substr(c1 + 1));
+
+    auto key = (param_set && seckey) ? prepare_key(*param_set, *seckey) : nullptr;
+    if (seckey) {
+      wipe(seckey->data(), seckey->size());
+    }
+
+    if (!key) {
+      std::fprintf(stderr, "failed to load key '%s'\n", spec.c_str());
+      return 1;
+    }
+
+    keys[key_id] = std::move(key);
+  }
+
+  if (keys.empty()) {
+    std::fprintf(stderr, "no key given\n");
+    return 1;
+  }
+
+  const int listen_fd = listen_on(config.socket_path);
+  if (listen_fd < 0) {
+    std::fprintf(stderr, "failed to listen on %s: %s\n", config.socket_path.c_str(), std::strerror(errno));
+    return 1;
+  }
+
+  // Without SA_RESTART, so that blocking accept returns on signal.
+  struct sigaction action{};
+  action.sa_handler = on_signal;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+
+  std::fprintf(stderr, "serving %zu key(s) on %s, %zu worker thread(s), batch window %ldus, max batch %zu\n", keys.size(), config.socket_path.c_str(), config.threads, static_cast<long>(config.batch_window.count()), config.max_batch);
+
+  daemon_t daemon(config, std::move(keys));
+  daemon.run(listen_fd, stop_requested);
+
+  close(listen_fd);
+  unlink(config.socket_path.c_str());
+
+  return 0;
+}
+
+struct load_config_t
+{
+  std::string socket_path;
+  uint32_t key_id = 0;
+  size_t connections = 4;
+  size_t requests = 10000;
+  size_t pipeline = 8;
+  size_t msg_len = 32;
+  bool use_mu = false;
+  std::optional<ml_dsa_runtime::param_set_t> param_set;
+  std::vector<uint8_t> pubkey;
+};
+
+struct load_result_t
+{
+  std::vector<double> latencies_us;
+  size_t failures = 0;
+};
+
+// Sends request and receives response, on a fresh connection, for fetching tr of a key.
+static std::optional<std::array<uint8_t, 64>>
+fetch_tr(const std::string& socket_path, const uint32_t key_id)
+{
+  const int fd = connect_to(socket_path);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+
+  const request_header_t req{ 0, key_id, static_cast<uint8_t>(request_kind_t::get_tr), {}, 0 };
+  response_header_t resp{};
+  std::array<uint8_t, 64> tr{};
+
+  const bool ok = write_all(fd, &req, sizeof(req)) && read_exact(fd, &resp, sizeof(resp)) && (resp.status == 0) && (resp.len == tr.size()) &&
+                  read_exact(fd, tr.data(), tr.size());
+  close(fd);
+
+  return ok ? std::optional(tr) : std::nullopt;
+}
+
+// Drives one connection: keeps up to `pipeline` requests in flight, until `n` requests are answered.
+static load_result_t
+drive_connection(const load_config_t& config, const size_t n, const std::array<uint8_t, 64>& tr)
+{
+  load_result_t result;
+  result.latencies_us.reserve(n);
+
+  const int fd = connect_to(config.socket_path);
+  if (fd < 0) {
+    result.failures = n;
+    return result;
+  }
+
+  ml_dsa_prng::prng_t<256> prng;
+
+  const size_t slots = std::max<size_t>(1, std::min(config.pipeline, n));
+  std::vector<std::vector<uint8_t>> msgs(slots, std::vector<uint8_t>(config.msg_len));
+  std::vector<steady_clock::time_point> sent_at(slots);
+  std::array<uint8_t, ml_dsa::MU_BYTE_LEN> mu{};
+  std::vector<uint8_t> sig;
+
+  // Request id is the slot it occupies.
+  auto send_request = [&](const uint32_t slot) {
+    prng.read(msgs[slot]);
+
+    std::span<const uint8_t> payload = msgs[slot];
+    uint8_t kind = static_cast<uint8_t>(request_kind_t::sign_msg);
+
+    if (config.use_mu) {
+      ml_dsa::compute_mu(tr, msgs[slot], mu);
+      payload = mu;
+      kind = static_cast<uint8_t>(request_kind_t::sign_mu);
+    }
+
+    const request_header_t hdr{ slot, config.key_id, kind, {}, static_cast<uint32_t>(payload.size()) };
+
+    sent_at[slot] = steady_clock::now();
+    return write_all(fd, &hdr, sizeof(hdr)) && write_all(fd, payload.data(), payload.size());
+  };
+
+  size_t sent = 0, received = 0;
+
+  for (uint32_t slot = 0; slot < slots; slot++) {
+    if (!send_request(slot)) {
+      break;
+    }
+    sent++;
+  }
+
+  while (received < sent) {
+    response_header_t resp{};
+    if (!read_exact(fd, &resp, sizeof(resp)) || (resp.id >= slots) || (resp.len > MAX_MSG_BYTE_LEN)) {
+      break;
+    }
+
+    sig.resize(resp.len);
+    if (!read_exact(fd, sig.data(), sig.size())) {
+      break;
+    }
+
+    const auto elapsed = std::chrono::duration<double, std::micro>(steady_clock::now() - sent_at[resp.id]);
+    received++;
+
+    bool ok = resp.status == static_cast<int32_t>(status_t::ok);
+    if (ok && config.param_set) {
+      ok = ml_dsa_runtime::verify(*config.param_set, config.pubkey, msgs[resp.id], sig);
+    }
+
+    if (ok) {
+      result.latencies_us.push_back(elapsed.count());
+    } else {
+      result.failures++;
+    }
+
+    if (sent < n) {
+      if (!send_request(resp.id)) {
+        break;
+      }
+      sent++;
+    }
+  }
+
+  result.failures += n - received;
+  close(fd);
+
+  return result;
+}
+
+static int
+load_main(const std::vector<std::string_view>& args)
+{
+  load_config_t config;
+
+  const auto socket_path = option(args, "--socket");
+  const auto key_id = option(args, "--key");
+
+  if (!socket_path || !key_id) {
+    std::fprintf(stderr, "usage: load --socket PATH --key ID [--connections C] [--requests N] [--pipeline P] [--msg-len M] [--mu] [--param-set 44|65|87 --pubkey FILE]\n");
+    return 1;
+  }
+
+  config.socket_path = *socket_path;
+  config.key_id = static_cast<uint32_t>(std::stoul(*key_id));
+  config.use_mu = flag(args, "--mu");
+
+  if (const auto v = option(args, "--connections")) {
+    config.connections = std::max<size_t>(1, std::stoul(*v));
+  }
+  if (const auto v = option(args, "--requests")) {
+    config.requests = std::stoul(*v);
+  }
+  if (const auto v = option(args, "--pipeline")) {
+    config.pipeline = std::max<size_t>(1, std::stoul(*v));
+  }
+  if (const auto v = option(args, "--msg-len")) {
+    config.msg_len = std::min(std::stoul(*v), MAX_MSG_BYTE_LEN);
+  }
+
+  const auto ps_name = option(args, "--param-set");
+  const auto pubkey_path = option(args, "--pubkey");
+
+  if (ps_name && pubkey_path) {
+    config.param_set = parse_param_set(*ps_name);
+    const auto pubkey = read_file(*pubkey_path);
+
+    if (!config.param_set || !pubkey) {
+      std::fprintf(stderr, "failed to load public key '%s'\n", pubkey_path->c_str());
+      return 1;
+    }
+    config.pubkey = *pubkey;
+  }
+
+  std::array<uint8_t, 64> tr{};
+  if (config.use_mu) {
+    const auto fetched = fetch_tr(config.socket_path, config.key_id);
+    if (!fetched) {
+      std::fprintf(stderr, "failed to fetch tr of key %u\n", config.key_id);
+      return 1;
+    }
+    tr = *fetched;
+  }
+
+  std::vector<load_result_t> results(config.connections);
+  std::vector<std::thread> threads;
+
+  const auto t0 = steady_clock::now();
+
+  for (size_t i = 0; i < config.connections; i++) {
+    const size_t n = config.requests / config.connections + ((i < config.requests % config.connections) ? 1 : 0);
+    threads.emplace_back([&, i, n]() { results[i] = drive_connection(config, n, tr); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const double elapsed = std::chrono::duration<double>(steady_clock::now() - t0).count();
+
+  std::vector<double> latencies;
+  size_t failures = 0;
+
+  for (const auto& result : results) {
+    latencies.insert(latencies.end(), result.latencies_us.begin(), result.latencies_us.end());
+    failures += result.failures;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+
+  auto percentile = [&](const double p) {
+    if (latencies.empty()) {
+      return 0.;
+    }
+    const size_t rank = static_cast<size_t>(p * static_cast<double>(latencies.size() - 1) + 0.5);
+    return latencies[std::min(rank, latencies.size() - 1)];
+  };
+
+  std::printf("requests    : %zu ( %zu failed )\n", latencies.size() + failures, failures);
+  std::printf("connections : %zu x %zu in flight\n", config.connections, config.pipeline);
+  std::printf("throughput  : %.1f signatures/s\n", static_cast<double>(latencies.size()) / elapsed);
+  std::printf("latency     : p50 %.1fus, p90 %.1fus, p99 %.1fus, p99.9 %.1fus, max %.1fus\n",
+              percentile(0.5),
+              percentile(0.9),
+              percentile(0.99),
+              percentile(0.999),
+              latencies.empty() ? 0. : latencies.back());
+
+  return (failures == 0) ? 0 : 1;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+  const std::vector<std::string_view> args(argv + std::min(argc, 2), argv + argc);
+  const std::string_view cmd = (argc > 1) ? argv[1] : "";
+
+  try {
+    if (cmd == "keygen") {
+      return ml_dsa_signer::keygen_main(args);
+    }
+    if (cmd == "serve") {
+      return ml_dsa_signer::serve_main(args);
+    }
+    if (cmd == "load") {
+      return ml_dsa_signer::load_main(args);
+    }
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "error: %s\n", e.what());
+    return 1;
+  }
+
+  std::fprintf(stderr, "usage: %s keygen|serve|load [options], see tools/ml_dsa_signer.cpp\n", argv[0]);
+  return 1;
+}